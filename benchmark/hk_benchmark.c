@@ -0,0 +1,369 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-side microbenchmarks for the HK hot paths
+ *
+ *   Times HK_ProcessIncomingHkData, HK_SendCombinedHkPacket and a full
+ *   copy table swap (HK_ProcessNewCopyTable + HK_TearDownOldCopyTable)
+ *   over a set of synthetic copy tables. The cFE calls are served by the
+ *   unit test stubs, so the figures include the stub overhead and are
+ *   meant for comparing builds of HK, not for predicting flight timing.
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/*
+ * App Includes
+ */
+#include "hk_app.h"
+#include "hk_msg.h"
+#include "hk_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+#include <time.h>
+#include "cfe.h"
+
+/*
+ * Benchmark configuration, may be overridden on the compiler command line
+ */
+#ifndef HK_BENCH_ITERATIONS
+#define HK_BENCH_ITERATIONS 1000 /* Rounds of input messages and sends per parameter set */
+#endif
+
+#ifndef HK_BENCH_SWAP_ITERATIONS
+#define HK_BENCH_SWAP_ITERATIONS 100 /* Table swaps per parameter set */
+#endif
+
+#define HK_BENCH_BYTES_PER_ENTRY 4
+#define HK_BENCH_HDR_SIZE        sizeof(CFE_MSG_TelemetryHeader_t)
+#define HK_BENCH_MAX_MSG_SIZE    (HK_BENCH_HDR_SIZE + (HK_COPY_TABLE_ENTRIES * HK_BENCH_BYTES_PER_ENTRY))
+#define HK_BENCH_INPUT_MID_BASE  0x0900
+#define HK_BENCH_OUTPUT_MID_BASE 0x0A00
+
+/*
+ * Shape of a synthetic copy table: NumEntries rows spread round-robin over
+ * NumInputMids input messages, with EntriesPerOutput rows per output packet
+ */
+typedef struct
+{
+    uint16 NumEntries;
+    uint16 NumInputMids;
+    uint16 EntriesPerOutput;
+} HK_Bench_Params_t;
+
+static const HK_Bench_Params_t HK_Bench_ParamSets[] = {
+    {16, 4, 4}, {64, 16, 8}, {128, 128, 16}, {128, 16, 16}, {128, 8, 128}, {128, 1, 128},
+};
+
+/* hk_benchmark globals */
+HK_CopyTableEntry_t    HK_Bench_CopyTbl[HK_COPY_TABLE_ENTRIES];
+HK_RuntimeTableEntry_t HK_Bench_RtTbl[HK_COPY_TABLE_ENTRIES];
+uint32                 HK_Bench_InputMsgs[HK_COPY_TABLE_ENTRIES][(HK_BENCH_MAX_MSG_SIZE + 3) / 4];
+uint64                 HK_Bench_PoolArena[(HK_COPY_TABLE_ENTRIES * HK_BENCH_MAX_MSG_SIZE) / 8];
+size_t                 HK_Bench_PoolUsed;
+CFE_SB_MsgId_t         HK_Bench_CurrentMid;
+CFE_MSG_Size_t         HK_Bench_CurrentSize;
+
+/*
+ * Function Definitions
+ */
+
+static uint64 HK_Bench_NowNs(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+void UT_Handler_CFE_MSG_GetMsgId(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_MsgId_t *MsgId = UT_Hook_GetArgValueByName(Context, "MsgId", CFE_SB_MsgId_t *);
+
+    *MsgId = HK_Bench_CurrentMid;
+}
+
+void UT_Handler_CFE_MSG_GetSize(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Size_t *Size = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *);
+
+    *Size = HK_Bench_CurrentSize;
+}
+
+void UT_Handler_CFE_ES_GetPoolBuf(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_ES_MemPoolBuf_t *BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_ES_MemPoolBuf_t *);
+    size_t               Size   = UT_Hook_GetArgValueByName(Context, "Size", size_t);
+
+    /* Bump allocation, the arena is reset after each table teardown */
+    *BufPtr = (uint8 *)HK_Bench_PoolArena + HK_Bench_PoolUsed;
+    HK_Bench_PoolUsed += (Size + 7) & ~(size_t)7;
+}
+
+/* Number of rows of each input message, rounded up */
+static uint16 HK_Bench_EntriesPerInput(const HK_Bench_Params_t *Params)
+{
+    return (Params->NumEntries + Params->NumInputMids - 1) / Params->NumInputMids;
+}
+
+/* Number of output packets, rounded up */
+static uint16 HK_Bench_NumOutputs(const HK_Bench_Params_t *Params)
+{
+    return (Params->NumEntries + Params->EntriesPerOutput - 1) / Params->EntriesPerOutput;
+}
+
+void HK_Bench_InitCopyTable(const HK_Bench_Params_t *Params)
+{
+    HK_CopyTableEntry_t *CpyEntry;
+    uint16               i;
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        CpyEntry = &HK_Bench_CopyTbl[i];
+
+        if (i < Params->NumEntries)
+        {
+            CpyEntry->InputMid     = CFE_SB_ValueToMsgId(HK_BENCH_INPUT_MID_BASE + (i % Params->NumInputMids));
+            CpyEntry->InputOffset  = HK_BENCH_HDR_SIZE + ((i / Params->NumInputMids) * HK_BENCH_BYTES_PER_ENTRY);
+            CpyEntry->OutputMid    = CFE_SB_ValueToMsgId(HK_BENCH_OUTPUT_MID_BASE + (i / Params->EntriesPerOutput));
+            CpyEntry->OutputOffset = HK_BENCH_HDR_SIZE + ((i % Params->EntriesPerOutput) * HK_BENCH_BYTES_PER_ENTRY);
+            CpyEntry->NumBytes     = HK_BENCH_BYTES_PER_ENTRY;
+        }
+        else
+        {
+            CpyEntry->InputMid     = CFE_SB_INVALID_MSG_ID;
+            CpyEntry->InputOffset  = 0;
+            CpyEntry->OutputMid    = CFE_SB_INVALID_MSG_ID;
+            CpyEntry->OutputOffset = 0;
+            CpyEntry->NumBytes     = 0;
+        }
+    }
+}
+
+/* Clamp a parameter set to the configured table size */
+static void HK_Bench_GetParams(uint32 SetIdx, HK_Bench_Params_t *Params)
+{
+    *Params = HK_Bench_ParamSets[SetIdx];
+
+    if (Params->NumEntries > HK_COPY_TABLE_ENTRIES)
+    {
+        Params->NumEntries = HK_COPY_TABLE_ENTRIES;
+    }
+    if (Params->NumInputMids > Params->NumEntries)
+    {
+        Params->NumInputMids = Params->NumEntries;
+    }
+    if (Params->EntriesPerOutput > Params->NumEntries)
+    {
+        Params->EntriesPerOutput = Params->NumEntries;
+    }
+}
+
+/* Reset the stubs and HK, then activate the copy table described by Params */
+void HK_Bench_Setup(const HK_Bench_Params_t *Params)
+{
+    UT_ResetState(0);
+
+    memset(&HK_AppData, 0, sizeof(HK_AppData));
+    memset(HK_Bench_InputMsgs, 0, sizeof(HK_Bench_InputMsgs));
+    HK_Bench_PoolUsed = 0;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), UT_Handler_CFE_MSG_GetMsgId, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_Handler_CFE_MSG_GetSize, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetPoolBuf), UT_Handler_CFE_ES_GetPoolBuf, NULL);
+
+    HK_Bench_InitCopyTable(Params);
+
+    HK_AppData.CopyTablePtr    = HK_Bench_CopyTbl;
+    HK_AppData.RuntimeTablePtr = HK_Bench_RtTbl;
+
+    HK_ProcessNewCopyTable(HK_Bench_CopyTbl, HK_Bench_RtTbl);
+}
+
+/* Feed every input message of the table to HK once */
+void HK_Bench_FeedAllInputs(const HK_Bench_Params_t *Params)
+{
+    uint16 i;
+
+    HK_Bench_CurrentSize = HK_BENCH_HDR_SIZE + (HK_Bench_EntriesPerInput(Params) * HK_BENCH_BYTES_PER_ENTRY);
+
+    for (i = 0; i < Params->NumInputMids; i++)
+    {
+        HK_Bench_CurrentMid = CFE_SB_ValueToMsgId(HK_BENCH_INPUT_MID_BASE + i);
+        HK_ProcessIncomingHkData((const CFE_SB_Buffer_t *)HK_Bench_InputMsgs[i]);
+    }
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Benchmarks                                                         */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_ProcessIncomingHkData
+ *
+ * Case: Every input message of the table is received in turn, reports
+ *       the average cost of one input message.
+ */
+void Bench_HK_ProcessIncomingHkData(void)
+{
+    HK_Bench_Params_t Params;
+    uint64            StartNs;
+    uint64            ElapsedNs;
+    uint32            SetIdx;
+    uint32            Iter;
+    uint16            i;
+    CFE_SB_MsgId_t    MissingMid;
+    uint16            NumMissing;
+    int32             NumIncomplete;
+
+    for (SetIdx = 0; SetIdx < (sizeof(HK_Bench_ParamSets) / sizeof(HK_Bench_ParamSets[0])); SetIdx++)
+    {
+        HK_Bench_GetParams(SetIdx, &Params);
+        HK_Bench_Setup(&Params);
+
+        StartNs = HK_Bench_NowNs();
+        for (Iter = 0; Iter < HK_BENCH_ITERATIONS; Iter++)
+        {
+            HK_Bench_FeedAllInputs(&Params);
+        }
+        ElapsedNs = HK_Bench_NowNs() - StartNs;
+
+        UtPrintf("HK_ProcessIncomingHkData entries=%u inputs=%u fanout=%u: %lu ns/msg", (unsigned int)Params.NumEntries,
+                 (unsigned int)Params.NumInputMids, (unsigned int)Params.EntriesPerOutput,
+                 (unsigned long)(ElapsedNs / ((uint64)HK_BENCH_ITERATIONS * Params.NumInputMids)));
+
+        /* Every output packet must have been filled completely */
+        NumIncomplete = 0;
+        for (i = 0; i < HK_AppData.NumOutputPkts; i++)
+        {
+            if (HK_CheckForMissingData(&HK_AppData.OutputPkts[i], &MissingMid, &NumMissing) != HK_NO_MISSING_DATA)
+            {
+                NumIncomplete++;
+            }
+        }
+
+        UtAssert_INT32_EQ(HK_AppData.NumOutputPkts, HK_Bench_NumOutputs(&Params));
+        UtAssert_INT32_EQ(NumIncomplete, 0);
+    }
+}
+
+/*
+ * Function under test: HK_SendCombinedHkPacket
+ *
+ * Case: All output packets are complete and sent in turn, reports the
+ *       average cost of one send. Refilling the packets is not timed.
+ */
+void Bench_HK_SendCombinedHkPacket(void)
+{
+    HK_Bench_Params_t Params;
+    uint64            StartNs;
+    uint64            ElapsedNs;
+    uint32            SetIdx;
+    uint32            Iter;
+    uint16            i;
+
+    for (SetIdx = 0; SetIdx < (sizeof(HK_Bench_ParamSets) / sizeof(HK_Bench_ParamSets[0])); SetIdx++)
+    {
+        HK_Bench_GetParams(SetIdx, &Params);
+        HK_Bench_Setup(&Params);
+
+        ElapsedNs = 0;
+        for (Iter = 0; Iter < HK_BENCH_ITERATIONS; Iter++)
+        {
+            HK_Bench_FeedAllInputs(&Params);
+
+            StartNs = HK_Bench_NowNs();
+            for (i = 0; i < HK_AppData.NumOutputPkts; i++)
+            {
+                HK_SendCombinedHkPacket(HK_AppData.OutputPkts[i].OutputMid);
+            }
+            ElapsedNs += HK_Bench_NowNs() - StartNs;
+        }
+
+        UtPrintf("HK_SendCombinedHkPacket entries=%u inputs=%u fanout=%u: %lu ns/send", (unsigned int)Params.NumEntries,
+                 (unsigned int)Params.NumInputMids, (unsigned int)Params.EntriesPerOutput,
+                 (unsigned long)(ElapsedNs / ((uint64)HK_BENCH_ITERATIONS * HK_Bench_NumOutputs(&Params))));
+
+        UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 0);
+        UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)),
+                           HK_BENCH_ITERATIONS * HK_Bench_NumOutputs(&Params));
+    }
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable, HK_TearDownOldCopyTable
+ *
+ * Case: The copy table is activated and torn down repeatedly, reports
+ *       the average cost of one table swap.
+ */
+void Bench_HK_ProcessNewCopyTable(void)
+{
+    HK_Bench_Params_t Params;
+    uint64            StartNs;
+    uint64            ElapsedNs;
+    uint32            SetIdx;
+    uint32            Iter;
+
+    for (SetIdx = 0; SetIdx < (sizeof(HK_Bench_ParamSets) / sizeof(HK_Bench_ParamSets[0])); SetIdx++)
+    {
+        HK_Bench_GetParams(SetIdx, &Params);
+        HK_Bench_Setup(&Params);
+
+        StartNs = HK_Bench_NowNs();
+        for (Iter = 0; Iter < HK_BENCH_SWAP_ITERATIONS; Iter++)
+        {
+            HK_TearDownOldCopyTable(HK_Bench_CopyTbl, HK_Bench_RtTbl);
+            HK_Bench_PoolUsed = 0;
+
+            HK_ProcessNewCopyTable(HK_Bench_CopyTbl, HK_Bench_RtTbl);
+        }
+        ElapsedNs = HK_Bench_NowNs() - StartNs;
+
+        UtPrintf("HK_ProcessNewCopyTable entries=%u inputs=%u fanout=%u: %lu ns/swap", (unsigned int)Params.NumEntries,
+                 (unsigned int)Params.NumInputMids, (unsigned int)Params.EntriesPerOutput,
+                 (unsigned long)(ElapsedNs / HK_BENCH_SWAP_ITERATIONS));
+
+        /* One allocation per output packet and one subscription per input message on every swap */
+        UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetPoolBuf)),
+                           (HK_BENCH_SWAP_ITERATIONS + 1) * HK_Bench_NumOutputs(&Params));
+        UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_Subscribe)), (HK_BENCH_SWAP_ITERATIONS + 1) * Params.NumInputMids);
+        UtAssert_INT32_EQ(HK_AppData.NumOutputPkts, HK_Bench_NumOutputs(&Params));
+    }
+}
+
+/*
+ * Register the benchmarks to be executed.
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Bench_HK_ProcessIncomingHkData, NULL, NULL, "Bench_HK_ProcessIncomingHkData");
+    UtTest_Add(Bench_HK_SendCombinedHkPacket, NULL, NULL, "Bench_HK_SendCombinedHkPacket");
+    UtTest_Add(Bench_HK_ProcessNewCopyTable, NULL, NULL, "Bench_HK_ProcessNewCopyTable");
+}
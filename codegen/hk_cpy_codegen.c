@@ -0,0 +1,281 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-side generator of the copy routine for a fixed copy table
+ *
+ *   Built together with a copy table source, it writes a C source holding
+ *   the rows of the table and HK_GenCopyInput, a switch with one case per
+ *   input MsgId in which the offsets and sizes of the rows are constants.
+ *   Rows that are adjacent in both the input message and the output packet
+ *   are copied together, like the copy program HK compiles at run time.
+ *   The building blocks of the routine are in fsw/src/hk_gen_copy.h.
+ */
+
+/*
+ * App Includes
+ */
+#include "cfe.h"
+#include "cfe_platform_cfg.h"
+#include "hk_tbl.h"
+
+#include <stdio.h>
+#include <string.h>
+
+extern HK_CopyTable_Array_t HK_CopyTable;
+
+/* Rows that copy data, grouped by input MsgId and then ordered for coalescing */
+static uint16 HK_Codegen_RowList[HK_COPY_TABLE_ENTRIES];
+
+/*
+ * The tool runs on the build host without cFE, so it checks MsgIds the way cFE SB does
+ */
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return !CFE_SB_MsgId_Equal(MsgId, CFE_SB_INVALID_MSG_ID) &&
+           (CFE_SB_MsgIdToValue(MsgId) <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
+}
+
+/*
+ * Whether a row copies data, HK only uses rows with a valid input and output MsgId
+ */
+static bool HK_Codegen_IsUsed(const HK_CopyTableEntry_t *Entry)
+{
+    return CFE_SB_IsValidMsgId(Entry->InputMid) && CFE_SB_IsValidMsgId(Entry->OutputMid);
+}
+
+/*
+ * Order of two rows: by input MsgId, then output MsgId, then output offset
+ */
+static int HK_Codegen_CompareRows(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
+{
+    unsigned long Value1 = (unsigned long)CFE_SB_MsgIdToValue(Entry1->InputMid);
+    unsigned long Value2 = (unsigned long)CFE_SB_MsgIdToValue(Entry2->InputMid);
+
+    if (Value1 == Value2)
+    {
+        Value1 = (unsigned long)CFE_SB_MsgIdToValue(Entry1->OutputMid);
+        Value2 = (unsigned long)CFE_SB_MsgIdToValue(Entry2->OutputMid);
+    }
+
+    if (Value1 == Value2)
+    {
+        Value1 = Entry1->OutputOffset;
+        Value2 = Entry2->OutputOffset;
+    }
+
+    return (Value1 > Value2) - (Value1 < Value2);
+}
+
+/*
+ * Writes one table row as an initializer
+ */
+static void HK_Codegen_WriteRow(FILE *Out, const HK_CopyTableEntry_t *Entry, uint16 Row)
+{
+    if (CFE_SB_MsgId_Equal(Entry->InputMid, CFE_SB_MSGID_RESERVED))
+    {
+        fprintf(Out, "    /* %3u */ {CFE_SB_MSGID_RESERVED, ", (unsigned int)Row);
+    }
+    else
+    {
+        fprintf(Out, "    /* %3u */ {CFE_SB_MSGID_WRAP_VALUE(0x%lX), ", (unsigned int)Row,
+                (unsigned long)CFE_SB_MsgIdToValue(Entry->InputMid));
+    }
+
+    fprintf(Out, "%u, ", (unsigned int)Entry->InputOffset);
+
+    if (CFE_SB_MsgId_Equal(Entry->OutputMid, CFE_SB_MSGID_RESERVED))
+    {
+        fprintf(Out, "CFE_SB_MSGID_RESERVED, ");
+    }
+    else
+    {
+        fprintf(Out, "CFE_SB_MSGID_WRAP_VALUE(0x%lX), ", (unsigned long)CFE_SB_MsgIdToValue(Entry->OutputMid));
+    }
+
+    fprintf(Out, "%u, %u},\n", (unsigned int)Entry->OutputOffset, (unsigned int)Entry->NumBytes);
+}
+
+/*
+ * Writes the copies and data present marks of the rows of one input MsgId
+ */
+static void HK_Codegen_WriteCase(FILE *Out, const HK_CopyTableEntry_t *Table, const uint16 *RowList,
+                                 uint16 NumRows)
+{
+    const HK_CopyTableEntry_t *Entry;
+    const HK_CopyTableEntry_t *Next;
+    uint32                     NumBytes;
+    uint16                     OpStart;
+    uint16                     OpEnd;
+    uint16                     Loop;
+
+    fprintf(Out, "        case 0x%lX:\n", (unsigned long)CFE_SB_MsgIdToValue(Table[RowList[0]].InputMid));
+
+    /* Rows that continue the previous one in both messages join its copy */
+    for (OpStart = 0; OpStart < NumRows; OpStart = OpEnd)
+    {
+        Entry    = &Table[RowList[OpStart]];
+        NumBytes = Entry->NumBytes;
+
+        for (OpEnd = OpStart + 1; OpEnd < NumRows; OpEnd++)
+        {
+            Next = &Table[RowList[OpEnd]];
+
+            if (!CFE_SB_MsgId_Equal(Next->OutputMid, Entry->OutputMid) ||
+                (Next->OutputOffset != (Entry->OutputOffset + NumBytes)) ||
+                (Next->InputOffset != (Entry->InputOffset + NumBytes)))
+            {
+                break;
+            }
+
+            NumBytes += Next->NumBytes;
+        }
+
+        if (NumBytes > 0)
+        {
+            fprintf(Out, "            HK_GEN_COPY(%u, InPtr, %u, %u, %lu);\n", (unsigned int)RowList[OpStart],
+                    (unsigned int)Entry->InputOffset, (unsigned int)Entry->OutputOffset, (unsigned long)NumBytes);
+        }
+    }
+
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        fprintf(Out, "            HK_GEN_MARK_PRESENT(%u, RefreshSecs);\n", (unsigned int)RowList[Loop]);
+    }
+
+    fprintf(Out, "            break;\n\n");
+}
+
+/*
+ * Writes the generated source for the table
+ */
+static void HK_Codegen_Write(FILE *Out, const HK_CopyTableEntry_t *Table)
+{
+    uint16 NumTblRows = HK_COPY_TABLE_ENTRIES;
+    uint16 NumRows    = 0;
+    uint16 GroupStart;
+    uint16 GroupEnd;
+    uint16 Loop;
+    uint16 Pos;
+    uint16 Row;
+
+    /* Unused rows at the end of the table are left out, like HK_CountCopyTableRows does */
+    while ((NumTblRows > 0) && !CFE_SB_IsValidMsgId(Table[NumTblRows - 1].InputMid) &&
+           !CFE_SB_IsValidMsgId(Table[NumTblRows - 1].OutputMid))
+    {
+        NumTblRows--;
+    }
+
+    /* Insertion sort, stable so that equal rows stay in table order */
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (HK_Codegen_IsUsed(&Table[Loop]))
+        {
+            for (Pos = NumRows;
+                 (Pos > 0) && (HK_Codegen_CompareRows(&Table[HK_Codegen_RowList[Pos - 1]], &Table[Loop]) > 0); Pos--)
+            {
+                HK_Codegen_RowList[Pos] = HK_Codegen_RowList[Pos - 1];
+            }
+
+            HK_Codegen_RowList[Pos] = Loop;
+            NumRows++;
+        }
+    }
+
+    fprintf(Out, "/*\n"
+                 " * Copy routine generated by hk-cpy-codegen, do not edit.\n"
+                 " *\n"
+                 " * HK uses it while the loaded copy table matches HK_GenCopyTable.\n"
+                 " */\n\n");
+    fprintf(Out, "#include \"hk_gen_copy.h\"\n\n");
+
+    /* An empty initializer is not valid C, an empty table still has one unused row */
+    fprintf(Out, "const HK_CopyTableEntry_t HK_GenCopyTable[] = {\n");
+    for (Row = 0; Row < NumTblRows; Row++)
+    {
+        HK_Codegen_WriteRow(Out, &Table[Row], Row);
+    }
+    if (NumTblRows == 0)
+    {
+        fprintf(Out, "    {CFE_SB_MSGID_RESERVED, 0, CFE_SB_MSGID_RESERVED, 0, 0},\n");
+    }
+    fprintf(Out, "};\n\n");
+    fprintf(Out, "const uint16 HK_GenCopyTableRows = %u;\n\n", (unsigned int)NumTblRows);
+
+    fprintf(Out, "void HK_GenCopyInput(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)\n"
+                 "{\n"
+                 "    const uint8 *InPtr       = (const uint8 *)BufPtr;\n"
+                 "    uint32       RefreshSecs = HK_GEN_REFRESH_SECS();\n\n"
+                 "    switch (CFE_SB_MsgIdToValue(MessageID))\n"
+                 "    {\n");
+
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        for (GroupEnd = GroupStart + 1; GroupEnd < NumRows; GroupEnd++)
+        {
+            if (!CFE_SB_MsgId_Equal(Table[HK_Codegen_RowList[GroupEnd]].InputMid,
+                                    Table[HK_Codegen_RowList[GroupStart]].InputMid))
+            {
+                break;
+            }
+        }
+
+        HK_Codegen_WriteCase(Out, Table, &HK_Codegen_RowList[GroupStart], GroupEnd - GroupStart);
+    }
+
+    fprintf(Out, "        default:\n"
+                 "            (void)InPtr;\n"
+                 "            (void)RefreshSecs;\n"
+                 "            break;\n"
+                 "    }\n"
+                 "}\n");
+}
+
+/*
+ * Writes the generated source to the file named on the command line, or to stdout
+ */
+int main(int argc, char *argv[])
+{
+    FILE *Out = stdout;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [output file]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc == 2)
+    {
+        Out = fopen(argv[1], "w");
+        if (Out == NULL)
+        {
+            fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+            return 1;
+        }
+    }
+
+    HK_Codegen_Write(Out, HK_CopyTable);
+
+    if (Out != stdout)
+    {
+        fclose(Out);
+    }
+
+    return 0;
+}
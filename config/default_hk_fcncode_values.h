@@ -35,8 +35,10 @@
 
 enum HK_FunctionCode
 {
-    HK_FunctionCode_NOOP           = 0,
-    HK_FunctionCode_RESET_COUNTERS = 1
+    HK_FunctionCode_NOOP                   = 0,
+    HK_FunctionCode_RESET_COUNTERS         = 1,
+    HK_FunctionCode_SEND_ALL_COMBINED_PKTS = 2,
+    HK_FunctionCode_WAKEUP                 = 3
 };
 
 #endif
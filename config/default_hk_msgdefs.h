@@ -32,12 +32,18 @@
  */
 typedef struct
 {
-    uint8              CmdCounter;          /**< \brief Count of valid commands received */
-    uint8              ErrCounter;          /**< \brief Count of invalid commands received */
-    uint16             Padding;             /**< \brief Padding to force 32 bit alignment */
-    uint16             CombinedPacketsSent; /**< \brief Count of combined tlm pkts sent */
-    uint16             MissingDataCtr;      /**< \brief Number of times missing data was detected */
-    CFE_ES_MemHandle_t MemPoolHandle;       /**< \brief Memory pool handle used to get mempool diags */
+    uint8              CmdCounter;           /**< \brief Count of valid commands received */
+    uint8              ErrCounter;           /**< \brief Count of invalid commands received */
+    uint16             Padding;              /**< \brief Padding to force 32 bit alignment */
+    uint16             CombinedPacketsSent;  /**< \brief Count of combined tlm pkts sent */
+    uint16             MissingDataCtr;       /**< \brief Number of times missing data was detected */
+    CFE_ES_MemHandle_t MemPoolHandle;        /**< \brief Memory pool handle used to get mempool diags */
+    uint32             MaxInputProcTime;     /**< \brief Longest input message processing time, in microseconds */
+    uint32             AvgInputProcTime;     /**< \brief Average input message processing time, in microseconds */
+    uint32             MaxSendTime;          /**< \brief Longest combined packet send time, in microseconds */
+    uint32             MaxTableSwapTime;     /**< \brief Longest copy table swap time, in microseconds */
+    uint16             PeakRecvBatch;        /**< \brief Most messages handled in one receive batch */
+    uint16             UnchangedPktsSkipped; /**< \brief Count of unchanged combined tlm pkts not sent */
 } HK_HkTlm_Payload_t;
 
 #endif
@@ -32,6 +32,7 @@
 #include "cfe_es_extern_typedefs.h"
 #include "cfe_sb_extern_typedefs.h"
 #include "cfe_msg_hdr.h"
+#include "hk_mission_cfg.h"
 
 /**
  * \defgroup cfshkcmdstructs CFS Housekeeping Command Structures
@@ -59,6 +60,30 @@ typedef struct
     HK_SendCombinedPkt_Payload_t Payload;
 } HK_SendCombinedPktCmd_t;
 
+/**
+ *  \brief Send All Combined Output Payload
+ *
+ *  For command details see #HK_SEND_ALL_COMBINED_PKTS_CC
+ */
+typedef struct
+{
+    uint16         NumPkts;                         /**< \brief Number of OutMsgIds to send, 0 sends all */
+    uint16         Spare;                           /**< \brief Structure padding */
+    CFE_SB_MsgId_t OutMsgIds[HK_SEND_ALL_MAX_PKTS]; /**< \brief MsgIds of combined tlm pkts to send */
+} HK_SendAllCombinedPkts_Payload_t;
+
+/**
+ *  \brief Send All Combined Output Messages Command
+ *
+ *  For command details see #HK_SEND_ALL_COMBINED_PKTS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Message Header */
+
+    HK_SendAllCombinedPkts_Payload_t Payload;
+} HK_SendAllCombinedPktsCmd_t;
+
 /**
  *  \brief Send HK command packet structure
  */
@@ -67,6 +92,16 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Message Header */
 } HK_SendHkCmd_t;
 
+/**
+ *  \brief Wakeup packet structure
+ *
+ *  Sends the combined packets that are due per the send schedule table
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Message Header */
+} HK_WakeupCmd_t;
+
 /**
  *  \brief No-Operation command packet structure
  *
@@ -37,6 +37,18 @@
 #include "hk_tbldefs.h"
 #include "hk_tblstruct.h"
 
+/**
+ * \name HK Send Schedule Table Incomplete Packet Policies
+ *
+ * Values of the IncompletePolicy field of #HK_SendSchedTableEntry_t, defined
+ * here rather than in hk_tbldefs.h so that EDS builds get them too.
+ * \{
+ */
+#define HK_INCOMPLETE_POLICY_DEFAULT 0 /**< \brief Discard incomplete packets if #HK_DISCARD_INCOMPLETE_COMBO is set */
+#define HK_INCOMPLETE_POLICY_SEND    1 /**< \brief Send incomplete packets */
+#define HK_INCOMPLETE_POLICY_DISCARD 2 /**< \brief Discard incomplete packets */
+/**\}*/
+
 /* Provide backward compatibility with existing table definitions */
 typedef HK_CopyTableEntry_t    hk_copy_table_entry_t;
 typedef HK_RuntimeTableEntry_t hk_runtime_tbl_entry_t;
@@ -37,6 +37,7 @@
 #include "hk_mission_cfg.h"
 #include "cfe_sb_extern_typedefs.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_time_extern_typedefs.h"
 
 /**  \brief HK Copy Table Entry Format
  */
@@ -58,4 +59,29 @@ typedef struct
     uint8               DataPresent;        /**< \brief Indicates if the data associated with the entry is present */
 } HK_RuntimeTableEntry_t;
 
+/**  \brief HK Send Schedule Table Entry Format
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t OutputMid;        /**< \brief MsgId of the combined output packet to send */
+    uint16         Period;           /**< \brief Number of wakeups between sends, 0 if not sent on schedule */
+    uint16         Phase;            /**< \brief Wakeup within the period on which the packet is sent */
+    uint16         CompleteTimeout;  /**< \brief Wakeups to wait for a complete packet, 0 if not sent when complete */
+    uint16         StaleThreshold;   /**< \brief Seconds after which an entry's data is stale, 0 if never stale */
+    uint16         IncompletePolicy; /**< \brief Send or discard the packet when data is missing */
+    uint16         Heartbeat;        /**< \brief Send requests between sends of an unchanged packet, 0 if always sent */
+} HK_SendSchedTableEntry_t;
+
+/**  \brief HK Input Statistics Table Entry Format
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t     InputMid;      /**< \brief MsgId of the input packet */
+    uint32             RcvCount;      /**< \brief Number of input packets received */
+    uint32             ShortPktCount; /**< \brief Number of input packets too short for a copy table entry */
+    uint32             MinInterval;   /**< \brief Shortest time between two input packets, in milliseconds */
+    uint32             MaxInterval;   /**< \brief Longest time between two input packets, in milliseconds */
+    CFE_TIME_SysTime_t LastRcvTime;   /**< \brief MET of the last input packet received */
+} HK_InputStatsTableEntry_t;
+
 #endif
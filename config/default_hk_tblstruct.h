@@ -43,4 +43,8 @@
 typedef HK_CopyTableEntry_t    HK_CopyTable_Array_t[HK_COPY_TABLE_ENTRIES];
 typedef HK_RuntimeTableEntry_t HK_RuntimeTable_Array_t[HK_COPY_TABLE_ENTRIES];
 
+typedef HK_SendSchedTableEntry_t HK_SendSchedTable_Array_t[HK_SEND_SCHED_TABLE_ENTRIES];
+
+typedef HK_InputStatsTableEntry_t HK_InputStatsTable_Array_t[HK_COPY_TABLE_ENTRIES];
+
 #endif
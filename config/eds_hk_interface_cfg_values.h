@@ -36,4 +36,10 @@
 
 #define HK_INTERFACE_CFGVAL(x) EdsParam_HK_##x
 
+/* Not a mission design parameter, must match the SendSchedTable dimension in hk.xml */
+#define EdsParam_HK_SEND_SCHED_TABLE_ENTRIES 16
+
+/* Not a mission design parameter, must match the SendAllMsgIdList dimension in hk.xml */
+#define EdsParam_HK_SEND_ALL_MAX_PKTS 8
+
 #endif
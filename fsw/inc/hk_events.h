@@ -170,7 +170,9 @@
  *  \par Cause:
  *
  *  This event message is issued when at least one section of data is missing in
- *  an output message.
+ *  an output message.  The event names the input packet of the first missing
+ *  section and the number of copy table entries of the output message that are
+ *  missing; the run-time table dump shows each entry's data present flag.
  */
 #define HK_OUTPKT_MISSING_DATA_EID 12
 
@@ -476,6 +478,174 @@
  */
 #define HK_NEWCPYTBL_INIT_FAILED_EID 37
 
+/**
+ * \brief HK Send Schedule Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_Register
+ *  for the send schedule table returns a value other than #CFE_SUCCESS
+ */
+#define HK_SSTBL_REG_ERR_EID 39
+
+/**
+ * \brief HK Send Schedule Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_Load
+ *  for the send schedule table returns a value other than #CFE_SUCCESS
+ */
+#define HK_SSTBL_LD_ERR_EID 40
+
+/**
+ * \brief HK Send Schedule Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_GetAddress
+ *  for the send schedule table fails. No packets are sent on schedule
+ *  until the address can be obtained again.
+ */
+#define HK_SSTBL_GADR_ERR_EID 41
+
+/**
+ * \brief HK Send Schedule Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a send schedule table entry is in use
+ *  but does not name a valid output MsgId, or its phase is not less than
+ *  its period.
+ */
+#define HK_SSTBL_VAL_ERR_EID 42
+
+/**
+ * \brief HK Send All Combined Packets Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the HK application receives a
+ *  \link #HK_SEND_ALL_COMBINED_PKTS_CC Send All Combined Packets command. \endlink
+ *  The event shows the number of combined packets named, zero for all of
+ *  them, and the number of combined packets sent.
+ */
+#define HK_SEND_ALL_DBG_EID 43
+
+/**
+ * \brief HK Input Statistics Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_Register
+ *  for the input statistics table returns a value other than #CFE_SUCCESS
+ */
+#define HK_ISTBL_REG_ERR_EID 44
+
+/**
+ * \brief HK Input Statistics Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_TBL_GetAddress
+ *  for the input statistics table returns a value other than #CFE_SUCCESS
+ */
+#define HK_ISTBL_GADR_ERR_EID 45
+
+/**
+ * \brief HK Input Statistics Table Dump Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the HK application receives an unexpected
+ *  return value from #CFE_TBL_GetStatus or #CFE_TBL_DumpToBuffer for the input
+ *  statistics table.  The statistics keep being collected.
+ */
+#define HK_ISTBL_DUMP_ERR_EID 46
+
+/**
+ * \brief HK Combined Packet Stale Data Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a combined packet is sent with data
+ *  that has not been refreshed within the stale threshold of its send
+ *  schedule table entry.  The stale data is zero filled.
+ */
+#define HK_OUTPKT_STALE_DATA_EID 47
+
+/**
+ * \brief HK Generated Copy Routine Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a new copy table is processed and HK
+ *  was built with #HK_GENERATED_COPY set.  It tells whether the generated
+ *  copy routine is used, or whether the table differs from the one the
+ *  routine was generated from and HK interprets it instead.
+ */
+#define HK_GEN_COPY_INF_EID 48
+
+/**
+ * \brief HK Send All Combined Packets Count Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a
+ *  \link #HK_SEND_ALL_COMBINED_PKTS_CC Send All Combined Packets command \endlink
+ *  names more output MsgIds than #HK_SEND_ALL_MAX_PKTS.
+ */
+#define HK_SEND_ALL_NUM_ERR_EID 49
+
+/**
+ * \brief HK Send All Combined Packets None Sent Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a
+ *  \link #HK_SEND_ALL_COMBINED_PKTS_CC Send All Combined Packets command \endlink
+ *  sends no combined packet.  The named MsgIds are not output messages of
+ *  the current copy table, or their packets were held back for missing data
+ *  or skipped as unchanged.
+ */
+#define HK_SEND_ALL_NONE_ERR_EID 50
+
+/**
+ * \brief HK Combined Packet Send Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when SB does not accept a combined packet.
+ *  The packet is not counted as sent.
+ */
+#define HK_OUTPKT_SEND_ERR_EID 51
+
 /**\}*/
 
 #endif
@@ -88,6 +88,77 @@
  */
 #define HK_RESET_COUNTERS_CC HK_CCVAL(RESET_COUNTERS)
 
+/**
+ * \brief Housekeeping Send All Combined Packets
+ *
+ *  \par Description
+ *       This command sends the combined output messages named by a list
+ *       of up to #HK_SEND_ALL_MAX_PKTS output MsgIds.  A count of zero
+ *       sends every combined output message of the current copy table in
+ *       one pass.
+ *
+ *  \par Command Structure
+ *       #HK_SendAllCombinedPktsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with the
+ *       following telemetry:
+ *       - #HK_HkTlm_Payload_t.CmdCounter will increment
+ *       - #HK_HkTlm_Payload_t.CombinedPacketsSent will increment for each
+ *         selected message that is sent
+ *       - The #HK_SEND_ALL_DBG_EID debug event message will be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - More than #HK_SEND_ALL_MAX_PKTS output MsgIds named
+ *       - No combined output message sent
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HK_HkTlm_Payload_t.ErrCounter will increment
+ *       - The #HK_CMD_LEN_ERR_EID error event message will be generated
+ *       - The #HK_SEND_ALL_NUM_ERR_EID error event message will be generated
+ *       - The #HK_SEND_ALL_NONE_ERR_EID error event message will be generated
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #HK_SEND_COMBINED_PKT_MID
+ */
+#define HK_SEND_ALL_COMBINED_PKTS_CC HK_CCVAL(SEND_ALL_COMBINED_PKTS)
+
+/**
+ * \brief Housekeeping Wakeup
+ *
+ *  \par Description
+ *       Sends the combined output messages that are due per the send
+ *       schedule table.  Meant to be sent by the scheduler at a fixed rate,
+ *       so it is not counted as a command.
+ *
+ *  \par Command Structure
+ *       #HK_WakeupCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with the
+ *       following telemetry:
+ *       - #HK_HkTlm_Payload_t.CombinedPacketsSent will increment for each
+ *         combined output message that is due
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HK_HkTlm_Payload_t.ErrCounter will increment
+ *       - The #HK_CMD_LEN_ERR_EID error event message will be generated
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #HK_SCHEDULED_OUTPUT
+ */
+#define HK_WAKEUP_CC HK_CCVAL(WAKEUP)
+
 /**\}*/
 
 #endif
@@ -39,6 +39,8 @@
  *
  *  \par Description:
  *       Dictates the number of elements in the hk copy table.
+ *       Table loads only scan up to the last populated entry, so
+ *       unused capacity costs memory but not processing time.
  *
  *  \par Limits
  *       The maximum size of this parameter is 8192
@@ -46,4 +48,34 @@
 #define HK_COPY_TABLE_ENTRIES                   HK_INTERFACE_CFGVAL(COPY_TABLE_ENTRIES)
 #define DEFAULT_HK_INTERFACE_COPY_TABLE_ENTRIES 128
 
+/**
+ *  \brief Maximum Number of HK Send Schedule Table Entries
+ *
+ *  \par Description:
+ *       Dictates the number of elements in the hk send schedule table,
+ *       one for each combined packet that HK sends on its own.
+ *       EDS builds fix it in the HK EDS and eds_hk_interface_cfg_values.h
+ *       so that missions need no new design parameter.
+ *
+ *  \par Limits
+ *       The minimum size of this parameter is 1
+ */
+#define HK_SEND_SCHED_TABLE_ENTRIES                   HK_INTERFACE_CFGVAL(SEND_SCHED_TABLE_ENTRIES)
+#define DEFAULT_HK_INTERFACE_SEND_SCHED_TABLE_ENTRIES 16
+
+/**
+ *  \brief Maximum Number of Combined Packets Named in a Send All Command
+ *
+ *  \par Description:
+ *       Dictates the number of output MsgIds that one
+ *       #HK_SEND_ALL_COMBINED_PKTS_CC command can select.
+ *       EDS builds fix it in the HK EDS and eds_hk_interface_cfg_values.h
+ *       so that missions need no new design parameter.
+ *
+ *  \par Limits
+ *       The minimum size of this parameter is 1
+ */
+#define HK_SEND_ALL_MAX_PKTS                   HK_INTERFACE_CFGVAL(SEND_ALL_MAX_PKTS)
+#define DEFAULT_HK_INTERFACE_SEND_ALL_MAX_PKTS 8
+
 #endif /* HK_EXTERN_TYPEDEFS_H */
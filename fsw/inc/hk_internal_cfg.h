@@ -54,13 +54,31 @@
 #define HK_PIPE_DEPTH                  HK_INTERNAL_CFGVAL(PIPE_DEPTH)
 #define DEFAULT_HK_INTERNAL_PIPE_DEPTH 40
 
+/**
+ *  \brief Receive Batch Limit
+ *
+ *  \par Description:
+ *       Dictates the maximum number of messages processed per wakeup of the
+ *       main loop. After the pending receive returns a message, HK keeps
+ *       polling the pipe until it is empty or this many messages have been
+ *       processed, and then checks the tables once for the whole batch.
+ *       A value of 1 processes exactly one message per wakeup.
+ *
+ *  \par Limits
+ *       The minimum size of this parameter is 1, the maximum is 65535
+ *       There is no benefit in making it larger than #HK_PIPE_DEPTH
+ */
+#define HK_RECV_BATCH_LIMIT                  HK_INTERNAL_CFGVAL(RECV_BATCH_LIMIT)
+#define DEFAULT_HK_INTERNAL_RECV_BATCH_LIMIT 1
+
 /**
  *  \brief Discard Incomplete Combo Packets
  *
  *  \par Description:
  *       Dictates whether combo packets that have not had all data contents
  *       updated since last requested will be discarded (YES = 1) or sent
- *       anyway (NO = 0).
+ *       anyway (NO = 0).  When #HK_SCHEDULED_OUTPUT is set, the send
+ *       schedule table entry of a packet can override this setting.
  *
  *  \par Limits
  *       This parameter can be set to 0 or 1 only.
@@ -68,13 +86,51 @@
 #define HK_DISCARD_INCOMPLETE_COMBO                  HK_INTERNAL_CFGVAL(DISCARD_INCOMPLETE_COMBO)
 #define DEFAULT_HK_INTERNAL_DISCARD_INCOMPLETE_COMBO 0
 
+/**
+ *  \brief Zero-Copy Combo Packet Send
+ *
+ *  \par Description:
+ *       Dictates whether combo packets are built directly in Software Bus
+ *       buffers and handed off to SB without a copy (YES = 1), or built in
+ *       the HK memory pool and copied into SB on each send (NO = 0).
+ *       A zero-copy send hands the packet buffer itself to SB and continues
+ *       with a fresh buffer.  A packet that can be sent with missing data,
+ *       as when #HK_DISCARD_INCOMPLETE_COMBO is 0, has the data it sent
+ *       copied into the fresh buffer so that missing sections keep their
+ *       last values; that copy costs about what SB's copy would.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.
+ */
+#define HK_ZERO_COPY_SEND                  HK_INTERNAL_CFGVAL(ZERO_COPY_SEND)
+#define DEFAULT_HK_INTERNAL_ZERO_COPY_SEND 0
+
+/**
+ *  \brief Double Buffer Combo Packets
+ *
+ *  \par Description:
+ *       Dictates whether each combo packet keeps a second, ready to use SB
+ *       buffer (YES = 1) or allocates its next buffer when it is sent (NO = 0).
+ *       With a second buffer a send only hands the filled buffer to SB and
+ *       switches to the spare one; the spare is replaced after the messages
+ *       of the current wakeup have been processed.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only, and can only be set
+ *       to 1 if #HK_ZERO_COPY_SEND is also set.
+ */
+#define HK_DOUBLE_BUFFER_OUTPUT                  HK_INTERNAL_CFGVAL(DOUBLE_BUFFER_OUTPUT)
+#define DEFAULT_HK_INTERNAL_DOUBLE_BUFFER_OUTPUT 0
+
 /**
  *  \brief Number of bytes in the HK Memory Pool
  *
  *  \par Description:
  *       The HK memory pool contains the memory needed for the output packets.
  *       The output packets are dynamically allocated from this pool when the
- *       HK copy table is initially processed or loaded with new data.
+ *       HK copy table is initially processed or loaded with new data.  A copy
+ *       table whose output packets do not fit in the pool is rejected when it
+ *       is validated.
  *
  *  \par Limits
  *       The Housekeeping app does not place a limit on this parameter, but there is
@@ -84,6 +140,145 @@
 #define HK_NUM_BYTES_IN_MEM_POOL                  HK_INTERNAL_CFGVAL(NUM_BYTES_IN_MEM_POOL)
 #define DEFAULT_HK_INTERNAL_NUM_BYTES_IN_MEM_POOL (6 * 1024)
 
+/**
+ *  \brief Output Packet Arena
+ *
+ *  \par Description:
+ *       Dictates whether the output packets are carved one after the other
+ *       from the HK memory pool buffer (YES = 1) or allocated from a cFE ES
+ *       memory pool created in it (NO = 0).  The carved packets are only
+ *       given back all at once, when a new copy table is processed, so the
+ *       pool holds exactly the output packets with no block overhead or
+ *       fragmentation.  No ES memory pool is created.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only, and cannot be set to 1
+ *       together with #HK_ZERO_COPY_SEND or #HK_INCREMENTAL_TABLE_UPDATE.
+ */
+#define HK_OUTPUT_ARENA                  HK_INTERNAL_CFGVAL(OUTPUT_ARENA)
+#define DEFAULT_HK_INTERNAL_OUTPUT_ARENA 0
+
+/**
+ *  \brief Collect Timing Statistics
+ *
+ *  \par Description:
+ *       Dictates whether HK times its input message processing, combined
+ *       packet sends and copy table swaps against the spacecraft MET and
+ *       reports the results in its housekeeping telemetry (YES = 1), or
+ *       leaves those telemetry points at zero (NO = 0).
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.
+ */
+#define HK_TIMING_STATS                  HK_INTERNAL_CFGVAL(TIMING_STATS)
+#define DEFAULT_HK_INTERNAL_TIMING_STATS 0
+
+/**
+ *  \brief Send Combo Packets On Schedule
+ *
+ *  \par Description:
+ *       Dictates whether HK loads the send schedule table and sends the
+ *       combo packets that are due on each #HK_WAKEUP_CC command (YES = 1),
+ *       or only sends combo packets on #HK_SEND_COMBINED_PKT_MID requests
+ *       (NO = 0).  Requests are still honored when this is set.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.
+ */
+#define HK_SCHEDULED_OUTPUT                  HK_INTERNAL_CFGVAL(SCHEDULED_OUTPUT)
+#define DEFAULT_HK_INTERNAL_SCHEDULED_OUTPUT 0
+
+/**
+ *  \brief Send Combo Packets When Complete
+ *
+ *  \par Description:
+ *       Dictates whether a combo packet with a non-zero complete timeout in
+ *       the send schedule table is sent as soon as all of its data has
+ *       arrived (YES = 1), or combo packets are only sent on request or on
+ *       schedule (NO = 0).  If such a packet is still incomplete after its
+ *       timeout, in wakeups, it is sent incomplete.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only, and can only be set
+ *       to 1 if #HK_SCHEDULED_OUTPUT is also set.
+ */
+#define HK_SEND_WHEN_COMPLETE                  HK_INTERNAL_CFGVAL(SEND_WHEN_COMPLETE)
+#define DEFAULT_HK_INTERNAL_SEND_WHEN_COMPLETE 0
+
+/**
+ *  \brief Input Message Statistics
+ *
+ *  \par Description:
+ *       Dictates whether HK keeps reception statistics for each input
+ *       MsgId in the dump-only input statistics table (YES = 1), or does
+ *       not register that table (NO = 0).  Updating the statistics takes
+ *       constant time per input message.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.
+ */
+#define HK_INPUT_STATS                  HK_INTERNAL_CFGVAL(INPUT_STATS)
+#define DEFAULT_HK_INTERNAL_INPUT_STATS 0
+
+/**
+ *  \brief Stale Data Check
+ *
+ *  \par Description:
+ *       Dictates whether HK records the MET second at which the data of
+ *       each copy table entry was last refreshed and, when a combined
+ *       packet with a non-zero stale threshold in the send schedule table
+ *       is sent, zero fills and reports the entries older than that
+ *       threshold (YES = 1), or does not track data age (NO = 0).  The rest
+ *       of the packet is sent as usual.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.  Setting it to 1
+ *       requires #HK_SCHEDULED_OUTPUT to be set to 1.
+ */
+#define HK_STALE_DATA_CHECK                  HK_INTERNAL_CFGVAL(STALE_DATA_CHECK)
+#define DEFAULT_HK_INTERNAL_STALE_DATA_CHECK 0
+
+/**
+ *  \brief Incremental Copy Table Update
+ *
+ *  \par Description:
+ *       Dictates whether a copy table update keeps the output packets and
+ *       input subscriptions that the new table still uses (YES = 1), or
+ *       frees every packet and unsubscribes every input before the new
+ *       table is processed (NO = 0).  A packet is kept when the new table
+ *       has the same entries for its output MsgId, in the same order, and
+ *       keeps its data.  Only the packets and subscriptions that changed
+ *       are allocated, freed, subscribed or unsubscribed.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only.
+ */
+#define HK_INCREMENTAL_TABLE_UPDATE                  HK_INTERNAL_CFGVAL(INCREMENTAL_TABLE_UPDATE)
+#define DEFAULT_HK_INTERNAL_INCREMENTAL_TABLE_UPDATE 0
+
+/**
+ *  \brief Generated Copy Routine
+ *
+ *  \par Description:
+ *       Dictates whether HK is built with a copy routine generated from a
+ *       fixed copy table (YES = 1) or only interprets the loaded copy table
+ *       (NO = 0).  The generated routine is used while the loaded table
+ *       matches the table it was generated from, and HK falls back to
+ *       interpreting the loaded table otherwise.  The routine is written
+ *       by the hk-cpy-codegen tool and built into the app by the
+ *       HK_GENERATED_COPY CMake option, which this parameter follows.
+ *
+ *  \par Limits
+ *       This parameter can be set to 0 or 1 only, and must be 1 exactly
+ *       when the HK_GENERATED_COPY CMake option is set.
+ */
+#define HK_GENERATED_COPY HK_INTERNAL_CFGVAL(GENERATED_COPY)
+#ifdef HK_GENERATED_COPY_BUILD
+#define DEFAULT_HK_INTERNAL_GENERATED_COPY 1
+#else
+#define DEFAULT_HK_INTERNAL_GENERATED_COPY 0
+#endif
+
 /**
  *  \brief Name of the HK Copy Table
  *
@@ -108,6 +303,30 @@
 #define HK_RUNTIME_TABLE_NAME                  HK_INTERNAL_CFGVAL(RUNTIME_TABLE_NAME)
 #define DEFAULT_HK_INTERNAL_RUNTIME_TABLE_NAME "RuntimeTable"
 
+/**
+ *  \brief Name of the HK Send Schedule Table
+ *
+ *  \par Description:
+ *       This parameter defines the name of the HK Send Schedule Table.
+ *
+ *  \par Limits
+ *       The Housekeeping app does not place a limit on this parameter
+ */
+#define HK_SEND_SCHED_TABLE_NAME                  HK_INTERNAL_CFGVAL(SEND_SCHED_TABLE_NAME)
+#define DEFAULT_HK_INTERNAL_SEND_SCHED_TABLE_NAME "SendSchedTable"
+
+/**
+ *  \brief Name of the HK Input Statistics Table
+ *
+ *  \par Description:
+ *       This parameter defines the name of the HK Input Statistics Table.
+ *
+ *  \par Limits
+ *       The Housekeeping app does not place a limit on this parameter
+ */
+#define HK_INPUT_STATS_TABLE_NAME                  HK_INTERNAL_CFGVAL(INPUT_STATS_TABLE_NAME)
+#define DEFAULT_HK_INTERNAL_INPUT_STATS_TABLE_NAME "InputStatsTable"
+
 /**
  *  \brief HK Copy Table Filename
  *
@@ -122,6 +341,21 @@
 #define HK_COPY_TABLE_FILENAME                  HK_INTERNAL_CFGVAL(COPY_TABLE_FILENAME)
 #define DEFAULT_HK_INTERNAL_COPY_TABLE_FILENAME "/cf/hk_cpy_tbl.tbl"
 
+/**
+ *  \brief HK Send Schedule Table Filename
+ *
+ *  \par Description:
+ *       The value of this constant defines the filename of the HK Send
+ *       Schedule Table
+ *
+ *  \par Limits
+ *       The length of each string, including the NULL terminator cannot exceed
+ *       the #OS_MAX_PATH_LEN value.
+ */
+
+#define HK_SEND_SCHED_TABLE_FILENAME                  HK_INTERNAL_CFGVAL(SEND_SCHED_TABLE_FILENAME)
+#define DEFAULT_HK_INTERNAL_SEND_SCHED_TABLE_FILENAME "/cf/hk_sched_tbl.tbl"
+
 /**
  * \brief Mission specific version number for HK application
  *
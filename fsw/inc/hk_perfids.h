@@ -30,6 +30,36 @@
 
 #define HK_APPMAIN_PERF_ID 25 /**< \brief Main application performance ID */
 
+/**
+ * \brief Processing stage performance IDs
+ *
+ *  \par Description:
+ *       Performance IDs of the HK processing stages. Performance IDs are
+ *       shared by all the apps of a mission, so the defaults are placed
+ *       above the IDs that the other cFS apps use. A mission that already
+ *       uses these values can define its own before this file is included,
+ *       for example as compile definitions.
+ *
+ *  \par Limits:
+ *       Must be unique among the performance IDs of the mission and less
+ *       than CFE_MISSION_ES_PERF_MAX_IDS.
+ */
+#ifndef HK_INPUT_DATA_PERF_ID
+#define HK_INPUT_DATA_PERF_ID 100 /**< \brief Input message copy performance ID */
+#endif
+#ifndef HK_SEND_COMBINED_PERF_ID
+#define HK_SEND_COMBINED_PERF_ID 101 /**< \brief Combined packet send performance ID */
+#endif
+#ifndef HK_CHECK_TABLES_PERF_ID
+#define HK_CHECK_TABLES_PERF_ID 102 /**< \brief Table status check performance ID */
+#endif
+#ifndef HK_NEW_COPY_TABLE_PERF_ID
+#define HK_NEW_COPY_TABLE_PERF_ID 103 /**< \brief Copy table activation performance ID */
+#endif
+#ifndef HK_TEARDOWN_PERF_ID
+#define HK_TEARDOWN_PERF_ID 104 /**< \brief Copy table teardown performance ID */
+#endif
+
 /**\}*/
 
 #endif
@@ -50,6 +50,7 @@ void HK_AppMain(void)
 {
     CFE_Status_t     Status = CFE_SUCCESS;
     CFE_SB_Buffer_t *BufPtr = NULL;
+    uint16           NumReceived;
 
     /*
     ** Create the first Performance Log entry
@@ -87,8 +88,51 @@ void HK_AppMain(void)
 
             /* Perform Message Processing */
             HK_AppPipe(BufPtr);
+            NumReceived = 1;
+
+            /* Drain whatever else is queued without pending, up to the batch limit */
+            while ((NumReceived < HK_AppData.RecvBatchLimit) && (HK_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN))
+            {
+                Status = CFE_SB_ReceiveBuffer(&BufPtr, HK_AppData.CmdPipe, CFE_SB_POLL);
+                if (Status != CFE_SUCCESS)
+                {
+                    break;
+                }
+
+                HK_AppPipe(BufPtr);
+                NumReceived++;
+            }
+
+            /* An empty pipe just ends the batch */
+            if (Status == CFE_SB_NO_MESSAGE)
+            {
+                Status = CFE_SUCCESS;
+            }
+
+            /* Check for copy table load and runtime dump request once per batch */
+            if (HK_AppData.TableCheckPending)
+            {
+                HK_AppData.TableCheckPending = false;
+
+                if (HK_CheckStatusOfTables() != HK_SUCCESS)
+                {
+                    HK_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
+                }
+            }
+
+            /* SB cannot report the pipe depth, the size of the batch is the closest measure */
+            if (NumReceived > HK_AppData.PeakRecvBatch)
+            {
+                HK_AppData.PeakRecvBatch = NumReceived;
+            }
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+            /* Replace the spare buffers used by the sends of this wakeup */
+            HK_RefillSpareBuffers();
+#endif
         }
-        else if (Status == CFE_SB_TIME_OUT)
+
+        if (Status == CFE_SB_TIME_OUT)
         {
             /* Check for copy table load and runtime dump request. This is
              * generally done during the housekeeping cycle.  If we are
@@ -99,7 +143,7 @@ void HK_AppMain(void)
                 HK_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
             }
         }
-        else
+        else if (Status != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(HK_RCV_MSG_ERR_EID, CFE_EVS_EventType_ERROR,
                               "HK_APP Exiting due to CFE_SB_RcvMsg error 0x%08X", (unsigned int)Status);
@@ -131,7 +175,11 @@ CFE_Status_t HK_AppInit(void)
 {
     CFE_Status_t Status = CFE_SUCCESS;
 
-    HK_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
+    HK_AppData.RunStatus      = CFE_ES_RunStatus_APP_RUN;
+    HK_AppData.RecvBatchLimit = HK_RECV_BATCH_LIMIT;
+
+    /* No copy table has been processed yet, so any run-time table row may be in use */
+    HK_AppData.NumCopyTableRows = HK_COPY_TABLE_ENTRIES;
 
     /* Initialize housekeeping packet  */
     CFE_MSG_Init(CFE_MSG_PTR(HK_AppData.HkPacket.TelemetryHeader), CFE_SB_ValueToMsgId(HK_HK_TLM_MID),
@@ -183,14 +231,20 @@ CFE_Status_t HK_AppInit(void)
         return Status;
     }
 
+#if HK_OUTPUT_ARENA == 1
+    /* Combined output messages are carved directly from the pool buffer */
+    HK_AppData.ArenaUsed = 0;
+#else
     /* Create a memory pool for combined output messages */
-    Status = CFE_ES_PoolCreate(&HK_AppData.MemPoolHandle, HK_AppData.MemPoolBuffer, sizeof(HK_AppData.MemPoolBuffer));
+    Status = CFE_ES_PoolCreate(&HK_AppData.MemPoolHandle, HK_AppData.MemPoolBuffer.Data,
+                               sizeof(HK_AppData.MemPoolBuffer.Data));
     if (Status != CFE_SUCCESS)
     {
         CFE_EVS_SendEvent(HK_CR_POOL_ERR_EID, CFE_EVS_EventType_ERROR, "Error Creating Memory Pool,RC=0x%08X",
                           (unsigned int)Status);
         return Status;
     }
+#endif
 
     HK_ResetHkData();
 
@@ -246,6 +300,27 @@ CFE_Status_t HK_TableInit(void)
         return Status;
     }
 
+#if HK_INPUT_STATS == 1
+    /* Register The HK Input Statistics Table, it is filled in when the copy table is processed */
+    Status = CFE_TBL_Register(&HK_AppData.InputStatsTableHandle, HK_INPUT_STATS_TABLE_NAME,
+                              (sizeof(HK_InputStatsTableEntry_t) * HK_COPY_TABLE_ENTRIES),
+                              CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_DUMP_ONLY, NULL);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_ISTBL_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering Input Statistics Table,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    Status = CFE_TBL_GetAddress((void *)(&HK_AppData.InputStatsTablePtr), HK_AppData.InputStatsTableHandle);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_ISTBL_GADR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Getting Adr for Input Statistics Table,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+#endif
+
     Status = CFE_TBL_Load(HK_AppData.CopyTableHandle, CFE_TBL_SRC_FILE, HK_COPY_TABLE_FILENAME);
     if (Status != CFE_SUCCESS)
     {
@@ -298,6 +373,39 @@ CFE_Status_t HK_TableInit(void)
         return Status;
     }
 
+#if HK_SCHEDULED_OUTPUT == 1
+    /* Register The HK Send Schedule Table */
+    Status = CFE_TBL_Register(&HK_AppData.SendSchedTableHandle, HK_SEND_SCHED_TABLE_NAME,
+                              (sizeof(HK_SendSchedTableEntry_t) * HK_SEND_SCHED_TABLE_ENTRIES),
+                              CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP, HK_ValidateSendSchedTable);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_SSTBL_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering Send Schedule Table,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    Status = CFE_TBL_Load(HK_AppData.SendSchedTableHandle, CFE_TBL_SRC_FILE, HK_SEND_SCHED_TABLE_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_SSTBL_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading Send Schedule Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return Status;
+    }
+
+    Status = CFE_TBL_GetAddress((void *)(&HK_AppData.SendSchedTablePtr), HK_AppData.SendSchedTableHandle);
+    /* Status should be CFE_TBL_INFO_UPDATED because we loaded it above */
+    if (Status != CFE_TBL_INFO_UPDATED)
+    {
+        CFE_EVS_SendEvent(HK_SSTBL_GADR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Getting Adr for Send Schedule Table,RC=0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    /* The copy table was processed before the schedule was available */
+    HK_ApplySendSchedTable();
+#endif
+
     return CFE_SUCCESS;
 } /* HK_TableInit */
 
@@ -308,10 +416,22 @@ CFE_Status_t HK_TableInit(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HK_ResetHkData(void)
 {
-    HK_AppData.CmdCounter          = 0;
-    HK_AppData.ErrCounter          = 0;
-    HK_AppData.CombinedPacketsSent = 0;
-    HK_AppData.MissingDataCtr      = 0;
+    HK_AppData.CmdCounter           = 0;
+    HK_AppData.ErrCounter           = 0;
+    HK_AppData.CombinedPacketsSent  = 0;
+    HK_AppData.MissingDataCtr       = 0;
+    HK_AppData.UnchangedPktsSkipped = 0;
+
+    HK_AppData.MaxInputProcTime   = 0;
+    HK_AppData.InputProcTimeTotal = 0;
+    HK_AppData.InputProcCount     = 0;
+    HK_AppData.MaxSendTime        = 0;
+    HK_AppData.MaxTableSwapTime   = 0;
+    HK_AppData.PeakRecvBatch      = 0;
+
+#if HK_INPUT_STATS == 1
+    HK_ResetInputStats();
+#endif
 }
 
 /************************/
@@ -66,11 +66,21 @@ typedef struct
     uint8           CmdCounter; /**< \brief Number of valid commands received */
     uint8           ErrCounter; /**< \brief Number of invalid commands received */
 
-    uint16 MissingDataCtr;      /**< \brief Number of times missing data was detected */
-    uint16 CombinedPacketsSent; /**< \brief Count of combined output msgs sent */
-
-    CFE_ES_MemHandle_t MemPoolHandle; /**< \brief HK mempool handle for output pkts */
-    uint32             RunStatus;     /**< \brief HK App run status */
+    uint16 MissingDataCtr;       /**< \brief Number of times missing data was detected */
+    uint16 CombinedPacketsSent;  /**< \brief Count of combined output msgs sent */
+    uint16 UnchangedPktsSkipped; /**< \brief Count of unchanged combined output msgs not sent */
+
+    uint32 MaxInputProcTime;   /**< \brief Longest input message processing time, in subseconds */
+    uint64 InputProcTimeTotal; /**< \brief Sum of the input message processing times, in subseconds */
+    uint32 InputProcCount;     /**< \brief Number of timed input messages */
+    uint32 MaxSendTime;        /**< \brief Longest combined packet send time, in subseconds */
+    uint32 MaxTableSwapTime;   /**< \brief Longest copy table swap time, in subseconds */
+    uint16 PeakRecvBatch;      /**< \brief Most messages handled in one receive batch */
+
+    CFE_ES_MemHandle_t MemPoolHandle;     /**< \brief HK mempool handle for output pkts */
+    uint32             RunStatus;         /**< \brief HK App run status */
+    uint16             RecvBatchLimit;    /**< \brief Most messages handled in one receive batch */
+    bool               TableCheckPending; /**< \brief Table check deferred to the end of the receive batch */
 
     CFE_TBL_Handle_t CopyTableHandle;    /**< \brief Copy Table handle */
     CFE_TBL_Handle_t RuntimeTableHandle; /**< \brief Run-time table handle */
@@ -78,7 +88,60 @@ typedef struct
     HK_CopyTableEntry_t *   CopyTablePtr;    /**< \brief Ptr to copy table entry */
     HK_RuntimeTableEntry_t *RuntimeTablePtr; /**< \brief Ptr to run-time table entry */
 
-    uint8 MemPoolBuffer[HK_NUM_BYTES_IN_MEM_POOL]; /**< \brief HK mempool buffer */
+    CFE_TBL_Handle_t          SendSchedTableHandle; /**< \brief Send schedule table handle */
+    HK_SendSchedTableEntry_t *SendSchedTablePtr;    /**< \brief Ptr to send schedule table entry */
+    uint32                    WakeupCounter;        /**< \brief Number of wakeup messages received */
+
+    CFE_TBL_Handle_t           InputStatsTableHandle; /**< \brief Input statistics table handle */
+    HK_InputStatsTableEntry_t *InputStatsTablePtr;    /**< \brief Ptr to input statistics table entry */
+    CFE_Status_t               InputStatsTableStatus; /**< \brief Status of the last input statistics table check */
+
+    uint16 NumCopyTableRows; /**< \brief Copy table rows up to and including the last populated one */
+    bool   GenCopyActive;    /**< \brief Loaded copy table matches the generated copy routine */
+
+    HK_InputIndexEntry_t InputIndex[HK_COPY_TABLE_ENTRIES]; /**< \brief Input MsgId dispatch index, sorted by MsgId */
+    uint16               NumInputIndexEntries;              /**< \brief Number of valid entries in InputIndex */
+
+    uint16 InputEntryList[HK_COPY_TABLE_ENTRIES];    /**< \brief Copy table rows grouped by input MsgId */
+    uint16 ValidateEntryList[HK_COPY_TABLE_ENTRIES]; /**< \brief Candidate copy table rows sorted by output offset */
+    uint16 SortScratch[HK_COPY_TABLE_ENTRIES];       /**< \brief Work area for sorting copy table rows */
+
+    HK_CopyOp_t CopyOps[HK_COPY_TABLE_ENTRIES];     /**< \brief Compiled copy program */
+    uint16      NumCopyOps;                         /**< \brief Number of valid operations in CopyOps */
+    uint16      OpEntryList[HK_COPY_TABLE_ENTRIES]; /**< \brief Copy table rows covered by each operation */
+    uint16      PktOpList[HK_COPY_TABLE_ENTRIES];   /**< \brief Copy operations grouped by output packet */
+
+    HK_OutputPktEntry_t OutputPkts[HK_COPY_TABLE_ENTRIES];     /**< \brief Output packet descriptors, sorted by MsgId */
+    uint16              NumOutputPkts;                         /**< \brief Number of valid entries in OutputPkts */
+    uint16              OutputEntryList[HK_COPY_TABLE_ENTRIES]; /**< \brief Copy table rows grouped by output MsgId */
+    uint16              OutputBitPos[HK_COPY_TABLE_ENTRIES];    /**< \brief Data present bit of each copy table row */
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    uint16              SpareRefillList[HK_COPY_TABLE_ENTRIES]; /**< \brief Packets whose spare buffer was used */
+    uint16              NumSpareRefills;                        /**< \brief Number of packets in SpareRefillList */
+#endif
+
+    uint32 DataPresentBits[HK_DATA_PRESENT_WORDS]; /**< \brief Data present bitset, one bit per output entry */
+#if HK_STALE_DATA_CHECK == 1
+    uint32 RefreshTime[HK_COPY_TABLE_ENTRIES];     /**< \brief MET seconds each output entry was last refreshed */
+#endif
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+    HK_CopyTableEntry_t    PrevCopyTable[HK_COPY_TABLE_ENTRIES];    /**< \brief Saved rows of the replaced table */
+    HK_RuntimeTableEntry_t PrevRuntimeTable[HK_COPY_TABLE_ENTRIES]; /**< \brief Saved run-time rows */
+#if HK_STALE_DATA_CHECK == 1
+    uint32                 PrevRefreshTime[HK_COPY_TABLE_ENTRIES];  /**< \brief Refresh MET seconds of each saved row */
+#endif
+    uint16                 PrevOutputList[HK_COPY_TABLE_ENTRIES];   /**< \brief Saved packet rows, by output MsgId */
+    uint16                 PrevInputList[HK_COPY_TABLE_ENTRIES];    /**< \brief Subscribed saved rows, by input MsgId */
+    uint16                 NumPrevRows;                             /**< \brief Number of saved rows, 0 when none */
+    uint16                 NumPrevOutputRows;                       /**< \brief Number of rows in PrevOutputList */
+    uint16                 NumPrevInputRows;                        /**< \brief Number of rows in PrevInputList */
+    uint16                 CarryRow[HK_COPY_TABLE_ENTRIES];         /**< \brief Saved row whose data each row keeps */
+#endif
+
+    uint32 ArenaUsed; /**< \brief Bytes of MemPoolBuffer carved into output packets */
+
+    CFE_ES_STATIC_POOL_TYPE(HK_NUM_BYTES_IN_MEM_POOL) MemPoolBuffer; /**< \brief HK mempool buffer */
 } HK_AppData_t;
 
 /*************************************************************************
@@ -62,25 +62,97 @@ CFE_Status_t HK_SendHkCmd(const HK_SendHkCmd_t *BufPtr)
     PayloadPtr = &HK_AppData.HkPacket.Payload;
 
     /* copy data into housekeeping packet */
-    PayloadPtr->CmdCounter          = HK_AppData.CmdCounter;
-    PayloadPtr->ErrCounter          = HK_AppData.ErrCounter;
-    PayloadPtr->MissingDataCtr      = HK_AppData.MissingDataCtr;
-    PayloadPtr->CombinedPacketsSent = HK_AppData.CombinedPacketsSent;
-    PayloadPtr->MemPoolHandle       = HK_AppData.MemPoolHandle;
+    PayloadPtr->CmdCounter           = HK_AppData.CmdCounter;
+    PayloadPtr->ErrCounter           = HK_AppData.ErrCounter;
+    PayloadPtr->MissingDataCtr       = HK_AppData.MissingDataCtr;
+    PayloadPtr->CombinedPacketsSent  = HK_AppData.CombinedPacketsSent;
+    PayloadPtr->UnchangedPktsSkipped = HK_AppData.UnchangedPktsSkipped;
+    PayloadPtr->MemPoolHandle        = HK_AppData.MemPoolHandle;
+
+    /* The timing statistics are kept in subseconds and only converted here */
+    PayloadPtr->MaxInputProcTime = CFE_TIME_Sub2MicroSecs(HK_AppData.MaxInputProcTime);
+    PayloadPtr->AvgInputProcTime = 0;
+    if (HK_AppData.InputProcCount != 0)
+    {
+        PayloadPtr->AvgInputProcTime =
+            CFE_TIME_Sub2MicroSecs((uint32)(HK_AppData.InputProcTimeTotal / HK_AppData.InputProcCount));
+    }
+    PayloadPtr->MaxSendTime      = CFE_TIME_Sub2MicroSecs(HK_AppData.MaxSendTime);
+    PayloadPtr->MaxTableSwapTime = CFE_TIME_Sub2MicroSecs(HK_AppData.MaxTableSwapTime);
+    PayloadPtr->PeakRecvBatch    = HK_AppData.PeakRecvBatch;
 
     /* Send housekeeping telemetry packet...        */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(HK_AppData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(HK_AppData.HkPacket.TelemetryHeader), true);
 
-    /* Check for copy table load and runtime dump request */
-    if (HK_CheckStatusOfTables() != HK_SUCCESS)
+    if (HK_AppData.RecvBatchLimit > 1)
     {
+        /* Check for copy table load and runtime dump request once the receive batch is done */
+        HK_AppData.TableCheckPending = true;
+    }
+    else if (HK_CheckStatusOfTables() != HK_SUCCESS)
+    {
+        /* Check for copy table load and runtime dump request */
         HK_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
     }
 
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Wakeup                                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_WakeupCmd(const HK_WakeupCmd_t *BufPtr)
+{
+    HK_SendScheduledPackets();
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send all combined packets command                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_SendAllCombinedPktsCmd(const HK_SendAllCombinedPktsCmd_t *BufPtr)
+{
+    const HK_SendAllCombinedPkts_Payload_t *CmdPtr;
+    uint16                                  NumSent;
+
+    CmdPtr = &BufPtr->Payload;
+
+    if (CmdPtr->NumPkts > HK_SEND_ALL_MAX_PKTS)
+    {
+        CFE_EVS_SendEvent(HK_SEND_ALL_NUM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "HK Send All Combined Packets command, %d packets named, max is %d", (int)CmdPtr->NumPkts,
+                          (int)HK_SEND_ALL_MAX_PKTS);
+
+        HK_AppData.ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    NumSent = HK_SendAllCombinedPackets(CmdPtr->OutMsgIds, CmdPtr->NumPkts);
+
+    if (NumSent == 0)
+    {
+        CFE_EVS_SendEvent(HK_SEND_ALL_NONE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "HK Send All Combined Packets command, %d packets named, none sent", (int)CmdPtr->NumPkts);
+
+        HK_AppData.ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    CFE_EVS_SendEvent(HK_SEND_ALL_DBG_EID, CFE_EVS_EventType_DEBUG,
+                      "HK Send All Combined Packets command, %d packets named, %d sent", (int)CmdPtr->NumPkts,
+                      (int)NumSent);
+
+    HK_AppData.CmdCounter++;
+
+    return CFE_SUCCESS;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Noop command                                                    */
@@ -58,12 +58,46 @@ CFE_Status_t HK_SendCombinedPktCmd(const HK_SendCombinedPktCmd_t *BufPtr);
  *  \par Assumptions, External Events, and Notes:
  *       This command does not affect the command execution counter, but
  *       this command will increment the cmd error counter if an invalid cmd
- *       length is detected.
+ *       length is detected.  When more than one message is handled per
+ *       receive batch, the table status check is left to the main loop at
+ *       the end of the batch.
  *
  *  \param [in] BufPtr Pointer to command message header
  */
 CFE_Status_t HK_SendHkCmd(const HK_SendHkCmd_t *BufPtr);
 
+/**
+ * \brief Process wakeup message
+ *
+ *  \par Description
+ *       Sends the combined housekeeping messages that are due per the
+ *       send schedule table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       This message does not affect the command execution counter.
+ *
+ *  \param [in] BufPtr Pointer to command message header
+ *
+ *  \sa #HK_SendScheduledPackets
+ */
+CFE_Status_t HK_WakeupCmd(const HK_WakeupCmd_t *BufPtr);
+
+/**
+ * \brief Process send all combined packets command
+ *
+ *  \par Description
+ *       Sends the combined housekeeping messages selected by the packet
+ *       mask in one pass over the output packet descriptors.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HK_SEND_ALL_COMBINED_PKTS_CC
+ */
+CFE_Status_t HK_SendAllCombinedPktsCmd(const HK_SendAllCombinedPktsCmd_t *BufPtr);
+
 /**
  * \brief Process noop command
  *
@@ -156,6 +156,44 @@ void HK_ResetCountersVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send all combined packets command                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SendAllCombinedPktsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t ExpectedLength = sizeof(HK_SendAllCombinedPktsCmd_t);
+
+    if (HK_VerifyCmdLength(BufPtr, ExpectedLength) == HK_SUCCESS)
+    {
+        HK_SendAllCombinedPktsCmd((const HK_SendAllCombinedPktsCmd_t *)BufPtr);
+    }
+    else
+    {
+        HK_AppData.ErrCounter++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Wakeup command                                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_WakeupVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t ExpectedLength = sizeof(HK_WakeupCmd_t);
+
+    if (HK_VerifyCmdLength(BufPtr, ExpectedLength) == HK_SUCCESS)
+    {
+        HK_WakeupCmd((const HK_WakeupCmd_t *)BufPtr);
+    }
+    else
+    {
+        HK_AppData.ErrCounter++;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process a command pipe message                                  */
@@ -178,6 +216,14 @@ void HK_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             HK_ResetCountersVerifyDispatch(BufPtr);
             break;
 
+        case HK_SEND_ALL_COMBINED_PKTS_CC:
+            HK_SendAllCombinedPktsVerifyDispatch(BufPtr);
+            break;
+
+        case HK_WAKEUP_CC:
+            HK_WakeupVerifyDispatch(BufPtr);
+            break;
+
         default:
             CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
             CFE_EVS_SendEvent(HK_CC_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -40,6 +40,8 @@ static const EdsDispatchTable_EdsComponent_HK_Application_CFE_SB_Telecommand_t H
     {
         .NoopCmd_indication                        = HK_NoopCmd,
         .ResetCountersCmd_indication                       = HK_ResetCountersCmd,
+        .SendAllCombinedPktsCmd_indication                 = HK_SendAllCombinedPktsCmd,
+        .WakeupCmd_indication                              = HK_WakeupCmd,
     },
     .SEND_HK          =
     {
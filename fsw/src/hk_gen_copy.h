@@ -0,0 +1,103 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  Interface to the copy routine generated from a fixed copy table
+ *
+ *  The generated source is written by the hk-cpy-codegen tool, see
+ *  codegen/CMakeLists.txt, and is only built with the HK_GENERATED_COPY
+ *  CMake option.  The macros below are the building blocks it is made of.
+ */
+#ifndef HK_GEN_COPY_H
+#define HK_GEN_COPY_H
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+
+#include "cfe.h"
+#include "hk_app.h"
+#include "hk_utils.h"
+
+#include <string.h>
+
+/*************************************************************************
+ * Macro definitions
+ *************************************************************************/
+
+/**
+ * \brief Copy the data of a copy table row, or of adjacent rows, into its output packet
+ *
+ *  The offsets and size are constants of the generated table, so the
+ *  compiler can inline the copy.  The packet address is read from the
+ *  run-time table because it changes with each zero copy send.
+ */
+#define HK_GEN_COPY(Row, InPtr, InputOffset, OutputOffset, NumBytes)                                              \
+    memcpy((uint8 *)CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.RuntimeTablePtr[(Row)].OutputPktAddr) + (OutputOffset), \
+           (InPtr) + (InputOffset), (NumBytes))
+
+#if HK_STALE_DATA_CHECK == 1
+#define HK_GEN_REFRESH_SECS()            (CFE_TIME_GetMET().Seconds)
+#define HK_GEN_SET_REFRESH(BitPos, Secs) (HK_AppData.RefreshTime[(BitPos)] = (Secs))
+#else
+#define HK_GEN_REFRESH_SECS()            (0)
+#define HK_GEN_SET_REFRESH(BitPos, Secs) ((void)(Secs))
+#endif
+
+/**
+ * \brief Set the data present bit, and the refresh time, of a copy table row
+ */
+#define HK_GEN_MARK_PRESENT(Row, Secs)                                    \
+    do                                                                    \
+    {                                                                     \
+        uint16 BitPos = HK_AppData.OutputBitPos[(Row)];                   \
+        HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] |= \
+            (uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS);            \
+        HK_GEN_SET_REFRESH(BitPos, Secs);                                 \
+    } while (0)
+
+/*************************************************************************
+ * Exported data
+ *************************************************************************/
+
+extern const HK_CopyTableEntry_t HK_GenCopyTable[];   /**< \brief Copy table rows the routine was generated from */
+extern const uint16              HK_GenCopyTableRows; /**< \brief Number of rows in HK_GenCopyTable */
+
+/************************************************************************
+ * Exported Functions
+ ************************************************************************/
+
+/**
+ * \brief Generated copy routine
+ *
+ *  \par Description
+ *       Copies the data of an input message into the combined output
+ *       packets and sets the data present bits, with one case per input
+ *       MsgId of the generated table and the offsets and sizes built in.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called when the loaded copy table matches #HK_GenCopyTable
+ *       and the message holds every row of its MsgId.
+ *
+ *  \param[in] MessageID The MsgId of the input message.
+ *  \param[in] BufPtr    A pointer to the input message.
+ */
+void HK_GenCopyInput(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr);
+
+#endif
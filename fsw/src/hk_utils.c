@@ -30,6 +30,10 @@
 #include "hk_utils.h"
 #include "hk_app.h"
 #include "hk_events.h"
+#include "hk_perfids.h"
+#if HK_GENERATED_COPY == 1
+#include "hk_gen_copy.h"
+#endif
 #include <string.h>
 
 /*************************************************************************
@@ -43,49 +47,117 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr)
 {
-    HK_CopyTableEntry_t *   StartOfCopyTable = HK_AppData.CopyTablePtr;
-    HK_CopyTableEntry_t *   CpyTblEntry      = NULL;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = HK_AppData.RuntimeTablePtr;
-    HK_RuntimeTableEntry_t *RtTblEntry       = NULL;
-    uint16                  Loop             = 0;
-    CFE_SB_MsgId_t          MessageID        = CFE_SB_INVALID_MSG_ID;
-    uint8 *                 DestPtr          = NULL;
-    uint8 *                 SrcPtr           = NULL;
-    size_t                  MessageLength    = 0;
-    int32                   MessageErrors    = 0;
-    int32                   LastByteAccessed;
+    HK_CopyTableEntry_t *       StartOfCopyTable = HK_AppData.CopyTablePtr;
+    HK_CopyTableEntry_t *       CpyTblEntry      = NULL;
+    HK_RuntimeTableEntry_t *    StartOfRtTable   = HK_AppData.RuntimeTablePtr;
+    HK_RuntimeTableEntry_t *    RtTblEntry       = NULL;
+    const HK_InputIndexEntry_t *IndexEntry       = NULL;
+    const HK_CopyOp_t *         CopyOp           = NULL;
+    uint16                      OpLoop           = 0;
+    uint16                      NumOps           = 0;
+    uint16                      Loop             = 0;
+    uint16                      EntryIdx;
+    uint16                      BitPos;
+    CFE_SB_MsgId_t              MessageID     = CFE_SB_INVALID_MSG_ID;
+    uint8 *                     DestPtr       = NULL;
+    uint8 *                     SrcPtr        = NULL;
+    size_t                      MessageLength = 0;
+    int32                       MessageErrors = 0;
+    int32                       LastByteAccessed;
+    bool                        FitsAll;
+#if HK_TIMING_STATS == 1
+    CFE_TIME_SysTime_t StartTime = CFE_TIME_GetMET();
+    uint32             ElapsedTime;
+#endif
+#if HK_STALE_DATA_CHECK == 1
+    uint32 RefreshSecs;
+#endif
+
+    CFE_ES_PerfLogEntry(HK_INPUT_DATA_PERF_ID);
 
     CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
 
-    /* Spin thru the entire table looking for matches */
-    for (Loop = 0; Loop < HK_COPY_TABLE_ENTRIES; Loop++)
+    /* Only the rows that are fed by this MsgId are visited */
+    IndexEntry = HK_FindInputIndex(MessageID);
+    if (IndexEntry == NULL)
     {
-        CpyTblEntry = &StartOfCopyTable[Loop];
-        RtTblEntry  = &StartOfRtTable[Loop];
+        CFE_ES_PerfLogExit(HK_INPUT_DATA_PERF_ID);
+        return;
+    }
 
-        /* Does the inputMID for this table entry match what we're looking for */
-        if (CFE_SB_MsgId_Equal(MessageID, CpyTblEntry->InputMid))
-        {
-            /* Ensure that we don't reference past the end of the input packet */
-            CFE_MSG_GetSize(&BufPtr->Msg, &MessageLength);
-            LastByteAccessed = CpyTblEntry->InputOffset + CpyTblEntry->NumBytes;
-            if (MessageLength >= LastByteAccessed)
-            {
-                /* We have a match.  Build the Source and Destination addresses
-                   and move the data */
-                DestPtr = CFE_ES_MEMADDRESS_TO_PTR(RtTblEntry->OutputPktAddr);
-                DestPtr += CpyTblEntry->OutputOffset;
-                SrcPtr = ((uint8 *)BufPtr) + CpyTblEntry->InputOffset;
+    CFE_MSG_GetSize(&BufPtr->Msg, &MessageLength);
+
+#if HK_STALE_DATA_CHECK == 1
+    RefreshSecs = CFE_TIME_GetMET().Seconds;
+#endif
+
+    /* A packet that holds every operation needs no further bounds checks */
+    FitsAll = (MessageLength >= IndexEntry->MinLength);
+    NumOps  = IndexEntry->NumOps;
+
+#if HK_GENERATED_COPY == 1
+    /* The generated routine has the copies of the loaded table built in, a short packet is interpreted */
+    if (HK_AppData.GenCopyActive && FitsAll)
+    {
+        HK_GenCopyInput(MessageID, BufPtr);
+        NumOps = 0;
+    }
+#endif
+
+    for (OpLoop = 0; OpLoop < NumOps; OpLoop++)
+    {
+        CopyOp = &HK_AppData.CopyOps[IndexEntry->FirstOp + OpLoop];
 
-                memcpy(DestPtr, SrcPtr, CpyTblEntry->NumBytes);
+        /* Ensure that we don't reference past the end of the input packet */
+        if (FitsAll || (MessageLength >= (size_t)(CopyOp->InputOffset + CopyOp->NumBytes)))
+        {
+            /* Every row covered by the operation fits, move the data in one copy */
+            SrcPtr = ((uint8 *)BufPtr) + CopyOp->InputOffset;
+            memcpy(CopyOp->DestPtr, SrcPtr, CopyOp->NumBytes);
 
-                /* Set the data present field to indicate the data is there */
-                RtTblEntry->DataPresent = HK_DATA_PRESENT;
+            /* Set the data present bits to indicate the data is there */
+            for (Loop = 0; Loop < CopyOp->NumEntries; Loop++)
+            {
+                BitPos = HK_AppData.OutputBitPos[HK_AppData.OpEntryList[CopyOp->FirstEntry + Loop]];
+                HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] |=
+                    (uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS);
+#if HK_STALE_DATA_CHECK == 1
+                HK_AppData.RefreshTime[BitPos] = RefreshSecs;
+#endif
             }
-            else
+        }
+        else
+        {
+            /* Short packet, fall back to checking each covered row on its own */
+            for (Loop = 0; Loop < CopyOp->NumEntries; Loop++)
             {
-                /* Error: copy data is past the end of the input packet */
-                MessageErrors++;
+                EntryIdx    = HK_AppData.OpEntryList[CopyOp->FirstEntry + Loop];
+                CpyTblEntry = &StartOfCopyTable[EntryIdx];
+                RtTblEntry  = &StartOfRtTable[EntryIdx];
+
+                LastByteAccessed = CpyTblEntry->InputOffset + CpyTblEntry->NumBytes;
+                if (MessageLength >= LastByteAccessed)
+                {
+                    /* Build the Source and Destination addresses and move the data */
+                    DestPtr = CFE_ES_MEMADDRESS_TO_PTR(RtTblEntry->OutputPktAddr);
+                    DestPtr += CpyTblEntry->OutputOffset;
+                    SrcPtr = ((uint8 *)BufPtr) + CpyTblEntry->InputOffset;
+
+                    memcpy(DestPtr, SrcPtr, CpyTblEntry->NumBytes);
+
+                    /* Set the data present bit to indicate the data is there */
+                    BitPos = HK_AppData.OutputBitPos[EntryIdx];
+                    HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] |=
+                        (uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS);
+#if HK_STALE_DATA_CHECK == 1
+                    HK_AppData.RefreshTime[BitPos] = RefreshSecs;
+#endif
+                }
+                else
+                {
+                    /* Error: copy data is past the end of the input packet */
+                    MessageErrors++;
+                }
             }
         }
     }
@@ -97,621 +169,2776 @@ void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr)
                           "HK table definition exceeds packet length. MID:0x%08lX, Length:%d, Count:%d",
                           (unsigned long)CFE_SB_MsgIdToValue(MessageID), (int)MessageLength, (int)MessageErrors);
     }
+
+#if HK_INPUT_STATS == 1
+    HK_UpdateInputStats(IndexEntry, !FitsAll);
+#endif
+
+#if HK_SEND_WHEN_COMPLETE == 1
+    HK_SendCompletedPackets(IndexEntry);
+#endif
+
+#if HK_TIMING_STATS == 1
+    /* Messages HK does not use are not counted */
+    ElapsedTime = HK_GetElapsedSubsecs(StartTime);
+    HK_AppData.InputProcTimeTotal += ElapsedTime;
+    HK_AppData.InputProcCount++;
+    if (ElapsedTime > HK_AppData.MaxInputProcTime)
+    {
+        HK_AppData.MaxInputProcTime = ElapsedTime;
+    }
+#endif
+
+    CFE_ES_PerfLogExit(HK_INPUT_DATA_PERF_ID);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK validate the copy table contents                             */
+/* HK sort a list of copy table rows                               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HK_ValidateHkCopyTable(void *TblPtr)
+void HK_SortEntryList(uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                      HK_CompareFunc_t CompareFunc)
 {
-    int32                HKStatus;
-    int32                i;
-    HK_CopyTableEntry_t *EntryPtr;
-    size_t               EntryTail;
-    char                 IssueStringBuf[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    IssueStringBuf[0] = 0;
-    HKStatus          = HK_SUCCESS;
-    EntryPtr          = (HK_CopyTableEntry_t *)TblPtr;
-
-    /* Loop thru the table and add up all the bytes copied for testing overflow scenario */
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    uint16 *SrcList = EntryList;
+    uint16 *DstList = HK_AppData.SortScratch;
+    uint16 *TmpList;
+    uint32  Width;
+    uint32  Left;
+    uint32  Middle;
+    uint32  Right;
+    uint32  i;
+    uint32  j;
+    uint32  k;
+
+    /* Bottom-up merge sort, alternating between the list and the work area */
+    for (Width = 1; Width < NumEntries; Width *= 2)
     {
-        /* If the entry is not used, then NEITHER of the MID values should be set */
-        if (CFE_SB_IsValidMsgId(EntryPtr->OutputMid) || CFE_SB_IsValidMsgId(EntryPtr->InputMid))
+        for (Left = 0; Left < NumEntries; Left += (2 * Width))
         {
-            /* If it has an input MID but not a valid output, this is an error */
-            if (!CFE_SB_IsValidMsgId(EntryPtr->OutputMid))
-            {
-                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid Output MID: 0x%lx",
-                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
-                HKStatus = HK_ERROR;
-                break;
-            }
-
-            /* If it has an output MID but not a valid input, this is an error */
-            if (!CFE_SB_IsValidMsgId(EntryPtr->InputMid))
+            Middle = Left + Width;
+            if (Middle > NumEntries)
             {
-                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid Input MID: 0x%lx",
-                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->InputMid));
-                HKStatus = HK_ERROR;
-                break;
+                Middle = NumEntries;
             }
 
-            /* check input position */
-            EntryTail = EntryPtr->InputOffset;
-            EntryTail += EntryPtr->NumBytes;
-
-            /* Check if the accumulated bytes exceed the allowed packet size, indicating an overflow */
-            if (EntryTail > HK_MAX_COMBINED_PACKET_SIZE)
+            Right = Left + (2 * Width);
+            if (Right > NumEntries)
             {
-                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid input offset+size: %lu > %lu, mid 0x%lx",
-                         (unsigned long)EntryTail, (unsigned long)HK_MAX_COMBINED_PACKET_SIZE,
-                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->InputMid));
-                HKStatus = HK_ERROR;
-                break;
+                Right = NumEntries;
             }
 
-            /* check output position */
-            EntryTail = EntryPtr->OutputOffset;
-            EntryTail += EntryPtr->NumBytes;
-
-            /* Check if the accumulated bytes exceed the allowed packet size, indicating an overflow */
-            if (EntryTail > HK_MAX_COMBINED_PACKET_SIZE)
+            i = Left;
+            j = Middle;
+            for (k = Left; k < Right; k++)
             {
-                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid output offset+size: %lu > %lu, mid 0x%lx",
-                         (unsigned long)EntryTail, (unsigned long)HK_MAX_COMBINED_PACKET_SIZE,
-                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
-                HKStatus = HK_ERROR;
-                break;
+                /* Take from the left run on ties so equal rows keep their table order */
+                if ((i < Middle) && ((j >= Right) || (CompareFunc(&CpyTblPtr[SrcList[j]], &CpyTblPtr[SrcList[i]]) >= 0)))
+                {
+                    DstList[k] = SrcList[i];
+                    i++;
+                }
+                else
+                {
+                    DstList[k] = SrcList[j];
+                    j++;
+                }
             }
         }
 
-        ++EntryPtr;
+        TmpList = SrcList;
+        SrcList = DstList;
+        DstList = TmpList;
     }
 
-    /* Report any error as an event before leaving (IssueStringBuf should be filled with something). */
-    if (HKStatus != HK_SUCCESS)
+    if (SrcList != EntryList)
     {
-        CFE_EVS_SendEvent(HK_NEWCPYTBL_HK_FAILED_EID, CFE_EVS_EventType_ERROR, "HK Validate: %s at entry index %d\n",
-                          IssueStringBuf, (int)i);
+        memcpy(EntryList, SrcList, NumEntries * sizeof(EntryList[0]));
     }
-
-    return HKStatus;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK process new copy table                                       */
+/* HK find the first row of a sorted list not below a key          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t HK_ProcessNewCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+uint16 HK_LowerBoundEntryList(const uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                              const HK_CopyTableEntry_t *Key, HK_CompareFunc_t CompareFunc)
 {
-    HK_CopyTableEntry_t *   StartOfCopyTable = NULL;
-    HK_CopyTableEntry_t *   OuterCpyEntry    = NULL;
-    HK_CopyTableEntry_t *   InnerDefEntry    = NULL;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = NULL;
-    HK_RuntimeTableEntry_t *OuterRtEntry     = NULL;
-    HK_RuntimeTableEntry_t *InnerRtEntry     = NULL;
-    int32                   Loop1            = 0;
-    int32                   Loop2;
-    CFE_SB_MsgId_t          MidOfThisPacket;
-    int32                   SizeOfThisPacket;
-    int32                   FurthestByteFromThisEntry;
-    CFE_SB_Buffer_t *       NewPacketAddr;
-    CFE_Status_t            Result;
+    uint16 Low  = 0;
+    uint16 High = NumEntries;
+    uint16 Middle;
 
-    /* Ensure that the input arguments are valid */
-    if (((void *)CpyTblPtr == NULL) || ((void *)RtTblPtr == NULL))
+    while (Low < High)
     {
-        CFE_EVS_SendEvent(HK_NULL_POINTER_NEWCPY_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Null pointer detected in new copy tbl processing: CpyTbl = %p, RtTbl = %p",
-                          (void *)CpyTblPtr, (void *)RtTblPtr);
-        return HK_NULL_POINTER_DETECTED;
+        Middle = Low + ((High - Low) / 2);
+
+        if (CompareFunc(&CpyTblPtr[EntryList[Middle]], Key) < 0)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
     }
 
-    StartOfCopyTable = CpyTblPtr;
-    StartOfRtTable   = RtTblPtr;
+    return Low;
+}
 
-    /* Loop thru the RunTime table initializing the fields */
-    for (Loop1 = 0; Loop1 < HK_COPY_TABLE_ENTRIES; Loop1++)
-    {
-        OuterRtEntry = &StartOfRtTable[Loop1];
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK compare two copy table rows by input MsgId                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_CompareInputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
+{
+    CFE_SB_MsgId_Atom_t Value1 = CFE_SB_MsgIdToValue(Entry1->InputMid);
+    CFE_SB_MsgId_Atom_t Value2 = CFE_SB_MsgIdToValue(Entry2->InputMid);
 
-        OuterRtEntry->OutputPktAddr      = CFE_ES_MEMADDRESS_C(0);
-        OuterRtEntry->InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
-        OuterRtEntry->DataPresent        = HK_DATA_NOT_PRESENT;
+    if (Value1 < Value2)
+    {
+        return -1;
     }
 
-    /* Loop thru the table looking for all of the SB packets that need to be built */
-    for (Loop1 = 0; Loop1 < HK_COPY_TABLE_ENTRIES; Loop1++)
+    if (Value1 > Value2)
     {
-        OuterCpyEntry = &StartOfCopyTable[Loop1];
-        OuterRtEntry  = &StartOfRtTable[Loop1];
-
-        /* If the both MIDs exists but the Packet Address has yet to be assigned,
-           we need to build an SB packet, so compute the size */
-        if (CFE_SB_IsValidMsgId(OuterCpyEntry->OutputMid) && CFE_SB_IsValidMsgId(OuterCpyEntry->InputMid) &&
-            (CFE_ES_MEMADDRESS_TO_PTR(OuterRtEntry->OutputPktAddr) == NULL))
-        {
-            /* We have a table entry that needs a SB message to be built */
-            MidOfThisPacket  = OuterCpyEntry->OutputMid;
-            SizeOfThisPacket = 0;
-
-            /* Spin thru entire table looking for duplicate OutputMid's.  This will let
-               us find the byte offset furthest from the beginning of the packet */
-            for (Loop2 = 0; Loop2 < HK_COPY_TABLE_ENTRIES; Loop2++)
-            {
-                InnerDefEntry = &StartOfCopyTable[Loop2];
-
-                /* If this entry's MID matches the one we're looking for */
-                if (CFE_SB_MsgId_Equal(InnerDefEntry->OutputMid, MidOfThisPacket))
-                {
-                    /* The byte furthest away from the section described by this entry */
-                    FurthestByteFromThisEntry = InnerDefEntry->OutputOffset + InnerDefEntry->NumBytes;
-
-                    /* Save the byte offset of the byte furthest from the packet start */
-                    if (FurthestByteFromThisEntry > SizeOfThisPacket)
-                    {
-                        SizeOfThisPacket = FurthestByteFromThisEntry;
-                    }
-                }
-            }
-
-            /* Build the packet with the size computed above */
-            NewPacketAddr = NULL;
-            if (SizeOfThisPacket > 0)
-            {
-                Result = CFE_ES_GetPoolBuf((void **)&NewPacketAddr, HK_AppData.MemPoolHandle, SizeOfThisPacket);
+        return 1;
+    }
 
-                if (Result >= CFE_SUCCESS)
-                {
-                    /* Spin thru entire table (again) looking for duplicate OutputMid's.
-                        This will let us assign the packet created above to all
-                        of the table entries that need to use it */
-                    for (Loop2 = 0; Loop2 < HK_COPY_TABLE_ENTRIES; Loop2++)
-                    {
-                        InnerDefEntry = &StartOfCopyTable[Loop2];
-                        InnerRtEntry  = &StartOfRtTable[Loop2];
-
-                        /* If this entry's MID matches the one we're looking for */
-                        if (CFE_SB_MsgId_Equal(InnerDefEntry->OutputMid, MidOfThisPacket))
-                        {
-                            InnerRtEntry->OutputPktAddr = CFE_ES_MEMADDRESS_C(NewPacketAddr);
-                        }
-                    }
+    return 0;
+}
 
-                    /* Init the SB Packet only once regardless of how many times its in the table */
-                    CFE_MSG_Init(&NewPacketAddr->Msg, MidOfThisPacket, SizeOfThisPacket);
-                }
-                else
-                {
-                    CFE_EVS_SendEvent(HK_MEM_POOL_MALLOC_FAILED_EID, CFE_EVS_EventType_ERROR,
-                                      "HK Processing New Table: ES_GetPoolBuf for size %d returned 0x%04X",
-                                      (int)SizeOfThisPacket, (unsigned int)Result);
-                }
-            }
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK build the input message dispatch index                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_BuildInputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    HK_InputIndexEntry_t *IndexEntry = NULL;
+    HK_CopyTableEntry_t * CpyTblEntry;
+    uint16                NumRows = 0;
+    uint16                NumIndexEntries = 0;
+    uint16                Loop;
+
+    /* Collect every row that can actually deliver data to an output packet */
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[Loop].InputMid) &&
+            (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr) != NULL))
+        {
+            HK_AppData.InputEntryList[NumRows] = Loop;
+            NumRows++;
         }
+    }
 
-        /* If HK needs to subscribe to this Input packet... */
-        if ((OuterRtEntry->InputMidSubscribed == HK_INPUTMID_NOT_SUBSCRIBED) &&
-            CFE_SB_IsValidMsgId(OuterCpyEntry->InputMid))
-        {
-            Result = CFE_SB_Subscribe(OuterCpyEntry->InputMid, HK_AppData.CmdPipe);
+    HK_SortEntryList(HK_AppData.InputEntryList, NumRows, CpyTblPtr, HK_CompareInputMid);
 
-            if (Result == CFE_SUCCESS)
-            {
-                /* Spin thru entire table (again) looking for duplicate InputMid's.
-                   This will let us mark each duplicate as already having been subscribed */
-                for (Loop2 = 0; Loop2 < HK_COPY_TABLE_ENTRIES; Loop2++)
-                {
-                    InnerDefEntry = &StartOfCopyTable[Loop2];
-                    InnerRtEntry  = &StartOfRtTable[Loop2];
+    /* Each run of identical input MsgIds becomes one index entry */
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        CpyTblEntry = &CpyTblPtr[HK_AppData.InputEntryList[Loop]];
 
-                    /* If this entry's MID matches the one we're looking for */
-                    if (CFE_SB_MsgId_Equal(OuterCpyEntry->InputMid, InnerDefEntry->InputMid))
-                    {
-                        InnerRtEntry->InputMidSubscribed = HK_INPUTMID_SUBSCRIBED;
-                    }
-                }
-            }
-            else
-            {
-                CFE_EVS_SendEvent(HK_CANT_SUBSCRIBE_TO_SB_PKT_EID, CFE_EVS_EventType_ERROR,
-                                  "HK Processing New Table:SB_Subscribe for Mid 0x%08lX returned 0x%04X",
-                                  (unsigned long)CFE_SB_MsgIdToValue(OuterCpyEntry->InputMid), (unsigned int)Result);
-            }
+        if ((IndexEntry == NULL) || !CFE_SB_MsgId_Equal(IndexEntry->InputMid, CpyTblEntry->InputMid))
+        {
+            IndexEntry             = &HK_AppData.InputIndex[NumIndexEntries];
+            IndexEntry->InputMid   = CpyTblEntry->InputMid;
+            IndexEntry->FirstEntry = Loop;
+            IndexEntry->NumEntries = 0;
+            NumIndexEntries++;
         }
+
+        IndexEntry->NumEntries++;
     }
 
-    return CFE_SUCCESS;
+    HK_AppData.NumInputIndexEntries = NumIndexEntries;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK Tear down old copy table                                     */
+/* HK compare two copy table rows by output position               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t HK_TearDownOldCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+int32 HK_CompareOutputPosition(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
 {
-    HK_CopyTableEntry_t *   StartOfCopyTable = NULL;
-    HK_CopyTableEntry_t *   OuterCpyEntry    = NULL;
-    HK_CopyTableEntry_t *   InnerDefEntry    = NULL;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = NULL;
-    HK_RuntimeTableEntry_t *OuterRtEntry     = NULL;
-    HK_RuntimeTableEntry_t *InnerRtEntry     = NULL;
-    int32                   Loop1            = 0;
-    int32                   Loop2;
-    CFE_SB_MsgId_t          MidOfThisPacket;
-    void *                  OutputPktAddr = NULL;
-    void *                  InnerPktAddr  = NULL;
-    void *                  SavedPktAddr  = NULL;
-    CFE_Status_t            Result;
+    CFE_SB_MsgId_Atom_t Value1 = CFE_SB_MsgIdToValue(Entry1->OutputMid);
+    CFE_SB_MsgId_Atom_t Value2 = CFE_SB_MsgIdToValue(Entry2->OutputMid);
 
-    /* Ensure that the input arguments are valid */
-    if (((void *)CpyTblPtr == NULL) || ((void *)RtTblPtr == NULL))
+    if (Value1 != Value2)
     {
-        CFE_EVS_SendEvent(HK_NULL_POINTER_TEARCPY_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Null pointer detected in copy tbl tear down: CpyTbl = %p, RtTbl = %p", (void *)CpyTblPtr,
-                          (void *)RtTblPtr);
-        return HK_NULL_POINTER_DETECTED;
+        return (Value1 < Value2) ? -1 : 1;
+    }
+
+    if (Entry1->OutputOffset != Entry2->OutputOffset)
+    {
+        return (Entry1->OutputOffset < Entry2->OutputOffset) ? -1 : 1;
     }
 
-    StartOfCopyTable = CpyTblPtr;
-    StartOfRtTable   = RtTblPtr;
+    return 0;
+}
 
-    /* Loop thru the table looking for all of the SB packets that need to be freed */
-    for (Loop1 = 0; Loop1 < HK_COPY_TABLE_ENTRIES; Loop1++)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK compile the copy program                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_CompileCopyProgram(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    HK_InputIndexEntry_t *IndexEntry;
+    HK_CopyTableEntry_t * CpyTblEntry;
+    HK_CopyTableEntry_t * PrevEntry = NULL;
+    HK_CopyOp_t *         CopyOp    = NULL;
+    HK_OutputPktEntry_t * OutPkt;
+    uint16 *              RowList;
+    uint16                NumOps = 0;
+    uint16                PktOp;
+    uint16                IndexLoop;
+    uint16                Loop;
+
+    for (IndexLoop = 0; IndexLoop < HK_AppData.NumInputIndexEntries; IndexLoop++)
     {
-        OuterCpyEntry = &StartOfCopyTable[Loop1];
-        OuterRtEntry  = &StartOfRtTable[Loop1];
+        IndexEntry = &HK_AppData.InputIndex[IndexLoop];
+        RowList    = &HK_AppData.OpEntryList[IndexEntry->FirstEntry];
 
-        /* If a Packet Address has been assigned, it needs to get deleted */
-        OutputPktAddr = CFE_ES_MEMADDRESS_TO_PTR(OuterRtEntry->OutputPktAddr);
-        if (OutputPktAddr != NULL)
+        memcpy(RowList, &HK_AppData.InputEntryList[IndexEntry->FirstEntry], IndexEntry->NumEntries * sizeof(RowList[0]));
+
+        /* Put the rows in output order so that neighbouring fields line up, validation has
+           rejected rows that write the same output bytes so the order does not matter */
+        HK_SortEntryList(RowList, IndexEntry->NumEntries, CpyTblPtr, HK_CompareOutputPosition);
+
+        /* Merge rows that continue the previous operation in both packets */
+        IndexEntry->FirstOp   = NumOps;
+        IndexEntry->MinLength = 0;
+        for (Loop = 0; Loop < IndexEntry->NumEntries; Loop++)
         {
-            MidOfThisPacket = OuterCpyEntry->OutputMid;
+            CpyTblEntry = &CpyTblPtr[RowList[Loop]];
 
-            SavedPktAddr = OutputPktAddr;
-            Result       = CFE_ES_PutPoolBuf(HK_AppData.MemPoolHandle, (uint32 *)OutputPktAddr);
-            if (Result >= CFE_SUCCESS)
+            if ((Loop > 0) && CFE_SB_MsgId_Equal(PrevEntry->OutputMid, CpyTblEntry->OutputMid) &&
+                (CpyTblEntry->InputOffset == CopyOp->InputOffset + CopyOp->NumBytes) &&
+                (CpyTblEntry->OutputOffset == PrevEntry->OutputOffset + PrevEntry->NumBytes))
+            {
+                CopyOp->NumBytes += CpyTblEntry->NumBytes;
+                CopyOp->NumEntries++;
+            }
+            else
             {
-                /* Spin thru the entire table looking for entries that used the same SB packets */
-                for (Loop2 = 0; Loop2 < HK_COPY_TABLE_ENTRIES; Loop2++)
+                CopyOp              = &HK_AppData.CopyOps[NumOps];
+                CopyOp->DestPtr     = CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[RowList[Loop]].OutputPktAddr);
+                CopyOp->DestPtr     += CpyTblEntry->OutputOffset;
+                CopyOp->InputOffset = CpyTblEntry->InputOffset;
+                CopyOp->NumBytes    = CpyTblEntry->NumBytes;
+                CopyOp->FirstEntry  = IndexEntry->FirstEntry + Loop;
+                CopyOp->NumEntries  = 1;
+                CopyOp->OutputPkt   = HK_AppData.NumOutputPkts;
+                NumOps++;
+
+                /* The output descriptors are built first, remember which one this operation feeds */
+                OutPkt = HK_FindOutputPkt(CpyTblEntry->OutputMid);
+                if (OutPkt != NULL)
                 {
-                    InnerDefEntry = &StartOfCopyTable[Loop2];
-                    InnerRtEntry  = &StartOfRtTable[Loop2];
-
-                    InnerPktAddr = CFE_ES_MEMADDRESS_TO_PTR(InnerRtEntry->OutputPktAddr);
-                    if (CFE_SB_MsgId_Equal(InnerDefEntry->OutputMid, MidOfThisPacket) && (InnerPktAddr == SavedPktAddr))
-                    {
-                        /* NULL out the table entry whose packet was freed above */
-                        InnerRtEntry->OutputPktAddr = CFE_ES_MEMADDRESS_C(0);
-                    }
+                    CopyOp->OutputPkt = (uint16)(OutPkt - HK_AppData.OutputPkts);
                 }
             }
-            else
+
+            if ((uint32)(CpyTblEntry->InputOffset + CpyTblEntry->NumBytes) > IndexEntry->MinLength)
             {
-                CFE_EVS_SendEvent(HK_MEM_POOL_FREE_FAILED_EID, CFE_EVS_EventType_ERROR,
-                                  "HK TearDown: ES_putPoolBuf Err pkt:0x%08lX ret 0x%04X, hdl 0x%08lx",
-                                  (unsigned long)SavedPktAddr, (unsigned int)Result,
-                                  CFE_RESOURCEID_TO_ULONG(HK_AppData.MemPoolHandle));
+                IndexEntry->MinLength = CpyTblEntry->InputOffset + CpyTblEntry->NumBytes;
             }
+
+            PrevEntry = CpyTblEntry;
         }
+        IndexEntry->NumOps = NumOps - IndexEntry->FirstOp;
+    }
 
-        /* If the InputMid for this Table Entry has been subscribed, it needs to
-           get Unsubscribed as do any other identical InputMids throughout the table.
-           We don't have to worry about leaving any Mid's subscribed since the entire table
-           is getting clobbered. */
-        if (OuterRtEntry->InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            CFE_SB_Unsubscribe(OuterCpyEntry->InputMid, HK_AppData.CmdPipe);
+    HK_AppData.NumCopyOps = NumOps;
 
-            /* Spin thru the entire table looking for entries that used the same SB packets */
-            for (Loop2 = 0; Loop2 < HK_COPY_TABLE_ENTRIES; Loop2++)
-            {
-                InnerDefEntry = &StartOfCopyTable[Loop2];
-                InnerRtEntry  = &StartOfRtTable[Loop2];
+    /* List the operations of each output packet, so a packet moved to a new buffer only visits its own */
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        HK_AppData.OutputPkts[Loop].NumOps = 0;
+    }
 
-                if (CFE_SB_MsgId_Equal(InnerDefEntry->InputMid, OuterCpyEntry->InputMid))
-                {
-                    InnerRtEntry->InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
-                }
-            }
+    for (Loop = 0; Loop < NumOps; Loop++)
+    {
+        if (HK_AppData.CopyOps[Loop].OutputPkt < HK_AppData.NumOutputPkts)
+        {
+            HK_AppData.OutputPkts[HK_AppData.CopyOps[Loop].OutputPkt].NumOps++;
         }
     }
 
-    return CFE_SUCCESS;
+    PktOp = 0;
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        OutPkt          = &HK_AppData.OutputPkts[Loop];
+        OutPkt->FirstOp = PktOp;
+        PktOp += OutPkt->NumOps;
+        OutPkt->NumOps = 0;
+    }
+
+    for (Loop = 0; Loop < NumOps; Loop++)
+    {
+        if (HK_AppData.CopyOps[Loop].OutputPkt < HK_AppData.NumOutputPkts)
+        {
+            OutPkt = &HK_AppData.OutputPkts[HK_AppData.CopyOps[Loop].OutputPkt];
+            HK_AppData.PktOpList[OutPkt->FirstOp + OutPkt->NumOps] = Loop;
+            OutPkt->NumOps++;
+        }
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK Send combined output message                                 */
+/* HK compare two copy table rows by output MsgId                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HK_SendCombinedHkPacket(CFE_SB_MsgId_t WhichMidToSend)
+int32 HK_CompareOutputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
 {
-    bool                    PacketFound      = false;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = HK_AppData.RuntimeTablePtr;
-    HK_RuntimeTableEntry_t *RtTblEntry       = NULL;
-    int32                   Loop             = 0;
-    CFE_SB_MsgId_t          ThisEntrysOutMid = CFE_SB_INVALID_MSG_ID;
-    CFE_SB_MsgId_t          InputMidMissing  = CFE_SB_INVALID_MSG_ID;
-    CFE_SB_Buffer_t *       OutBuffer        = NULL;
+    CFE_SB_MsgId_Atom_t Value1 = CFE_SB_MsgIdToValue(Entry1->OutputMid);
+    CFE_SB_MsgId_Atom_t Value2 = CFE_SB_MsgIdToValue(Entry2->OutputMid);
 
-    /* Look thru each item in this Table, but only send this packet once, at most */
-    for (Loop = 0; ((Loop < HK_COPY_TABLE_ENTRIES) && (PacketFound == false)); Loop++)
+    if (Value1 < Value2)
     {
-        RtTblEntry = &StartOfRtTable[Loop];
-
-        /* Empty table entries are defined by NULL's in this field */
-        OutBuffer = CFE_ES_MEMADDRESS_TO_PTR(RtTblEntry->OutputPktAddr);
-        if (OutBuffer != NULL)
-        {
-            CFE_MSG_GetMsgId(&OutBuffer->Msg, &ThisEntrysOutMid);
-
-            if (CFE_SB_MsgId_Equal(ThisEntrysOutMid, WhichMidToSend))
-            {
-                if (HK_CheckForMissingData(ThisEntrysOutMid, &InputMidMissing) == HK_MISSING_DATA_DETECTED)
-                {
-                    HK_AppData.MissingDataCtr++;
-
-                    CFE_EVS_SendEvent(HK_OUTPKT_MISSING_DATA_EID, CFE_EVS_EventType_DEBUG,
-                                      "Combined Packet 0x%08lX missing data from Input Pkt 0x%08lX",
-                                      (unsigned long)CFE_SB_MsgIdToValue(ThisEntrysOutMid),
-                                      (unsigned long)CFE_SB_MsgIdToValue(InputMidMissing));
-                }
-#if HK_DISCARD_INCOMPLETE_COMBO == 1
-                else /* This clause is only exclusive if discarding incomplete packets */
-#endif
-                {
-                    /* Send the combined housekeeping telemetry packet...        */
-                    CFE_SB_TimeStampMsg(&OutBuffer->Msg);
-                    CFE_SB_TransmitMsg(&OutBuffer->Msg, true);
-
-                    HK_AppData.CombinedPacketsSent++;
-                }
-
-                HK_SetFlagsToNotPresent(ThisEntrysOutMid);
-
-                PacketFound = true;
-            }
-        }
+        return -1;
     }
 
-    if (PacketFound == false)
+    if (Value1 > Value2)
     {
-        CFE_EVS_SendEvent(HK_UNKNOWN_COMBINED_PACKET_EID, CFE_EVS_EventType_INFORMATION,
-                          "Combined HK Packet 0x%08lX is not found in current HK Copy Table",
-                          (unsigned long)CFE_SB_MsgIdToValue(WhichMidToSend));
+        return 1;
     }
+
+    return 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Check the status of HK tables and perform any necessary action. */
+/* HK build the combined output packet descriptors                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HK_CheckStatusOfTables(void)
+void HK_BuildOutputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
 {
-    int32 HKStatus;
-
-    HKStatus = HK_CheckStatusOfCopyTable();
+    HK_OutputPktEntry_t *OutPkt = NULL;
+    HK_CopyTableEntry_t *CpyTblEntry;
+    uint16               EntryIdx;
+    uint16               NumRows = 0;
+    uint16               NumPkts = 0;
+    uint16               Loop;
+    size_t               LastByte;
+#if HK_STALE_DATA_CHECK == 1
+    uint32 NowSecs;
+#endif
+
+    /* Empty table entries are defined by NULL's in the output packet address */
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        if (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr) != NULL)
+        {
+            HK_AppData.OutputEntryList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(HK_AppData.OutputEntryList, NumRows, CpyTblPtr, HK_CompareOutputMid);
+
+    /* A new set of packets starts with no data present */
+    memset(HK_AppData.DataPresentBits, 0, sizeof(HK_AppData.DataPresentBits));
+
+#if HK_STALE_DATA_CHECK == 1
+    /* Data is only stale once the threshold has gone by since the table was processed */
+    NowSecs = CFE_TIME_GetMET().Seconds;
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        HK_AppData.RefreshTime[Loop] = NowSecs;
+    }
+#endif
+
+    /* Each run of identical output MsgIds becomes one packet descriptor */
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        EntryIdx    = HK_AppData.OutputEntryList[Loop];
+        CpyTblEntry = &CpyTblPtr[EntryIdx];
+
+        HK_AppData.OutputBitPos[EntryIdx] = Loop;
+
+        if ((OutPkt == NULL) || !CFE_SB_MsgId_Equal(OutPkt->OutputMid, CpyTblEntry->OutputMid))
+        {
+            OutPkt                    = &HK_AppData.OutputPkts[NumPkts];
+            OutPkt->OutputMid         = CpyTblEntry->OutputMid;
+            OutPkt->OutBuffer         = CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[EntryIdx].OutputPktAddr);
+            OutPkt->SpareBuffer       = NULL;
+            OutPkt->SpareQueued       = false;
+            OutPkt->PacketSize        = 0;
+            OutPkt->FirstEntry        = Loop;
+            OutPkt->NumEntries        = 0;
+            OutPkt->FirstOp           = 0;
+            OutPkt->NumOps            = 0;
+            OutPkt->CompleteTimeout   = 0;
+            OutPkt->WakeupsSinceSend  = 0;
+            OutPkt->StaleThreshold    = 0;
+            OutPkt->DiscardIncomplete = (HK_DISCARD_INCOMPLETE_COMBO == 1);
+            OutPkt->Heartbeat         = 0;
+            OutPkt->SkippedSends      = 0;
+            OutPkt->LastSentData      = NULL;
+            NumPkts++;
+        }
+
+        LastByte = CpyTblEntry->OutputOffset + CpyTblEntry->NumBytes;
+        if (LastByte > OutPkt->PacketSize)
+        {
+            OutPkt->PacketSize = LastByte;
+        }
+
+        OutPkt->NumEntries++;
+    }
+
+    HK_AppData.NumOutputPkts = NumPkts;
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    HK_AppData.NumSpareRefills = 0;
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK find the descriptor of a combined output packet              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+HK_OutputPktEntry_t *HK_FindOutputPkt(CFE_SB_MsgId_t OutputMid)
+{
+    CFE_SB_MsgId_Atom_t MidValue = CFE_SB_MsgIdToValue(OutputMid);
+    CFE_SB_MsgId_Atom_t EntryValue;
+    uint16              Low  = 0;
+    uint16              High = HK_AppData.NumOutputPkts;
+    uint16              Middle;
+
+    while (Low < High)
+    {
+        Middle     = Low + ((High - Low) / 2);
+        EntryValue = CFE_SB_MsgIdToValue(HK_AppData.OutputPkts[Middle].OutputMid);
+
+        if (EntryValue < MidValue)
+        {
+            Low = Middle + 1;
+        }
+        else if (EntryValue > MidValue)
+        {
+            High = Middle;
+        }
+        else
+        {
+            return &HK_AppData.OutputPkts[Middle];
+        }
+    }
+
+    return NULL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK find the dispatch index entry for an input message           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const HK_InputIndexEntry_t *HK_FindInputIndex(CFE_SB_MsgId_t InputMid)
+{
+    CFE_SB_MsgId_Atom_t MidValue = CFE_SB_MsgIdToValue(InputMid);
+    CFE_SB_MsgId_Atom_t EntryValue;
+    uint16              Low  = 0;
+    uint16              High = HK_AppData.NumInputIndexEntries;
+    uint16              Middle;
+
+    while (Low < High)
+    {
+        Middle     = Low + ((High - Low) / 2);
+        EntryValue = CFE_SB_MsgIdToValue(HK_AppData.InputIndex[Middle].InputMid);
+
+        if (EntryValue < MidValue)
+        {
+            Low = Middle + 1;
+        }
+        else if (EntryValue > MidValue)
+        {
+            High = Middle;
+        }
+        else
+        {
+            return &HK_AppData.InputIndex[Middle];
+        }
+    }
+
+    return NULL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK validate the copy table contents                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_ValidateHkCopyTable(void *TblPtr)
+{
+    int32                HKStatus;
+    int32                i;
+    HK_CopyTableEntry_t *EntryPtr;
+    size_t               EntryTail;
+    uint16               EntryIdx;
+    uint16               OtherIdx;
+    uint16               NumRows;
+    char                 IssueStringBuf[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+#if HK_OUTPUT_ARENA == 1
+    uint32 PoolBytes;
+#endif
+
+    IssueStringBuf[0] = 0;
+    HKStatus          = HK_SUCCESS;
+    EntryPtr          = (HK_CopyTableEntry_t *)TblPtr;
+
+    /* Rows past the last populated one are unused and need no checking */
+    NumRows = HK_CountCopyTableRows(EntryPtr);
+
+    /* Loop thru the table and add up all the bytes copied for testing overflow scenario */
+    for (i = 0; i < NumRows; i++)
+    {
+        /* If the entry is not used, then NEITHER of the MID values should be set */
+        if (CFE_SB_IsValidMsgId(EntryPtr->OutputMid) || CFE_SB_IsValidMsgId(EntryPtr->InputMid))
+        {
+            /* If it has an input MID but not a valid output, this is an error */
+            if (!CFE_SB_IsValidMsgId(EntryPtr->OutputMid))
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid Output MID: 0x%lx",
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            /* If it has an output MID but not a valid input, this is an error */
+            if (!CFE_SB_IsValidMsgId(EntryPtr->InputMid))
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid Input MID: 0x%lx",
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->InputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            /* check input position */
+            EntryTail = EntryPtr->InputOffset;
+            EntryTail += EntryPtr->NumBytes;
+
+            /* Check if the accumulated bytes exceed the allowed packet size, indicating an overflow */
+            if (EntryTail > HK_MAX_COMBINED_PACKET_SIZE)
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid input offset+size: %lu > %lu, mid 0x%lx",
+                         (unsigned long)EntryTail, (unsigned long)HK_MAX_COMBINED_PACKET_SIZE,
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->InputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            /* check output position */
+            EntryTail = EntryPtr->OutputOffset;
+            EntryTail += EntryPtr->NumBytes;
+
+            /* Check if the accumulated bytes exceed the allowed packet size, indicating an overflow */
+            if (EntryTail > HK_MAX_COMBINED_PACKET_SIZE)
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid output offset+size: %lu > %lu, mid 0x%lx",
+                         (unsigned long)EntryTail, (unsigned long)HK_MAX_COMBINED_PACKET_SIZE,
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            /* The output message header is built by HK and must not be overwritten */
+            if ((EntryPtr->NumBytes > 0) && (EntryPtr->OutputOffset < HK_OUTPUT_HDR_SIZE))
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Output offset in header: %lu < %lu, mid 0x%lx",
+                         (unsigned long)EntryPtr->OutputOffset, (unsigned long)HK_OUTPUT_HDR_SIZE,
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+        }
+
+        ++EntryPtr;
+    }
+
+    /* Only rows that are valid on their own are checked against each other */
+    if ((HKStatus == HK_SUCCESS) && HK_FindOutputOverlap((HK_CopyTableEntry_t *)TblPtr, NumRows, &EntryIdx, &OtherIdx))
+    {
+        EntryPtr = &((HK_CopyTableEntry_t *)TblPtr)[EntryIdx];
+        snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Output overlaps entry %d: offset %lu, mid 0x%lx",
+                 (int)OtherIdx, (unsigned long)EntryPtr->OutputOffset,
+                 (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+        HKStatus = HK_ERROR;
+        i        = EntryIdx;
+    }
+
+#if HK_OUTPUT_ARENA == 1
+    /* The output packets are carved one after the other from the pool memory, so whether they fit is exact here */
+    if ((HKStatus == HK_SUCCESS) &&
+        HK_FindOutputPoolOverflow((HK_CopyTableEntry_t *)TblPtr, NumRows, &EntryIdx, &PoolBytes))
+    {
+        EntryPtr = &((HK_CopyTableEntry_t *)TblPtr)[EntryIdx];
+        snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Output pkts need %lu > %lu pool bytes, mid 0x%lx",
+                 (unsigned long)PoolBytes, (unsigned long)sizeof(HK_AppData.MemPoolBuffer.Data),
+                 (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+        HKStatus = HK_ERROR;
+        i        = EntryIdx;
+    }
+#endif
+
+    /* Report any error as an event before leaving (IssueStringBuf should be filled with something). */
+    if (HKStatus != HK_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_NEWCPYTBL_HK_FAILED_EID, CFE_EVS_EventType_ERROR, "HK Validate: %s at entry index %d\n",
+                          IssueStringBuf, (int)i);
+    }
+
+    return HKStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK find overlapping output rows                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_FindOutputOverlap(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx, uint16 *OtherIdx)
+{
+    const HK_CopyTableEntry_t *CpyTblEntry;
+    const HK_CopyTableEntry_t *PrevEntry = NULL;
+    uint16 *                   RowList   = HK_AppData.ValidateEntryList;
+    uint16                     NumRows   = 0;
+    uint16                     FurthestRow;
+    uint32                     FurthestByte;
+    uint32                     EntryEnd;
+    uint16                     Loop;
+
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[Loop].OutputMid) && (CpyTblPtr[Loop].NumBytes > 0))
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareOutputPosition);
+
+    /* Within a packet the rows are in offset order, so a row overlaps if it starts before the furthest byte so far */
+    FurthestRow  = 0;
+    FurthestByte = 0;
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        CpyTblEntry = &CpyTblPtr[RowList[Loop]];
+
+        if ((PrevEntry == NULL) || !CFE_SB_MsgId_Equal(CpyTblEntry->OutputMid, PrevEntry->OutputMid))
+        {
+            FurthestByte = 0;
+        }
+        else if (CpyTblEntry->OutputOffset < FurthestByte)
+        {
+            *EntryIdx = RowList[Loop];
+            *OtherIdx = FurthestRow;
+            return true;
+        }
+
+        EntryEnd = (uint32)CpyTblEntry->OutputOffset + CpyTblEntry->NumBytes;
+        if (EntryEnd > FurthestByte)
+        {
+            FurthestRow  = RowList[Loop];
+            FurthestByte = EntryEnd;
+        }
+
+        PrevEntry = CpyTblEntry;
+    }
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK find the output packet that does not fit in the memory pool  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_FindOutputPoolOverflow(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx,
+                               uint32 *PoolBytes)
+{
+    const HK_CopyTableEntry_t *CpyTblEntry;
+    uint16 *                   RowList    = HK_AppData.ValidateEntryList;
+    uint16                     NumRows    = 0;
+    uint32                     TotalBytes = 0;
+    uint32                     PktSize;
+    uint32                     EntryEnd;
+    uint16                     GroupStart;
+    uint16                     GroupEnd;
+    uint16                     Loop;
+    bool                       Overflow = false;
+
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[Loop].OutputMid))
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareOutputMid);
+
+    /* Each packet is sized to the byte furthest from its start, as when the table is processed */
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        CpyTblEntry = &CpyTblPtr[RowList[GroupStart]];
+        PktSize     = 0;
+
+        for (GroupEnd = GroupStart; GroupEnd < NumRows; GroupEnd++)
+        {
+            if (!CFE_SB_MsgId_Equal(CpyTblPtr[RowList[GroupEnd]].OutputMid, CpyTblEntry->OutputMid))
+            {
+                break;
+            }
+
+            EntryEnd = (uint32)CpyTblPtr[RowList[GroupEnd]].OutputOffset + CpyTblPtr[RowList[GroupEnd]].NumBytes;
+            if (EntryEnd > PktSize)
+            {
+                PktSize = EntryEnd;
+            }
+        }
+
+        if (PktSize > 0)
+        {
+            TotalBytes += HK_OUTPUT_BLOCK_SIZE(PktSize);
+        }
+
+        if (!Overflow && (TotalBytes > sizeof(HK_AppData.MemPoolBuffer.Data)))
+        {
+            *EntryIdx = RowList[GroupStart];
+            Overflow  = true;
+        }
+    }
+
+    *PoolBytes = TotalBytes;
+
+    return Overflow;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK count the populated copy table rows                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 HK_CountCopyTableRows(const HK_CopyTableEntry_t *CpyTblPtr)
+{
+    uint16 NumRows = HK_COPY_TABLE_ENTRIES;
+
+    /* Unused rows are normally at the end of the table, so stop at the last populated one */
+    while (NumRows > 0)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[NumRows - 1].InputMid) ||
+            CFE_SB_IsValidMsgId(CpyTblPtr[NumRows - 1].OutputMid))
+        {
+            break;
+        }
+
+        NumRows--;
+    }
+
+    return NumRows;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK process new copy table                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_ProcessNewCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    HK_CopyTableEntry_t *   CpyTblEntry;
+    HK_RuntimeTableEntry_t *RtTblEntry;
+    uint16 *                RowList;
+    uint16                  NumRows;
+    uint16                  NumTblRows;
+    uint16                  NumClearRows;
+    uint16                  GroupStart;
+    uint16                  GroupEnd;
+    uint16                  Loop;
+    CFE_SB_MsgId_t          MidOfThisPacket;
+    int32                   SizeOfThisPacket;
+    int32                   FurthestByteFromThisEntry;
+    bool                    HasInput;
+    CFE_SB_Buffer_t *       NewPacketAddr;
+    CFE_Status_t            Result;
+
+    /* Ensure that the input arguments are valid */
+    if (((void *)CpyTblPtr == NULL) || ((void *)RtTblPtr == NULL))
+    {
+        CFE_EVS_SendEvent(HK_NULL_POINTER_NEWCPY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Null pointer detected in new copy tbl processing: CpyTbl = %p, RtTbl = %p",
+                          (void *)CpyTblPtr, (void *)RtTblPtr);
+        return HK_NULL_POINTER_DETECTED;
+    }
+
+    CFE_ES_PerfLogEntry(HK_NEW_COPY_TABLE_PERF_ID);
+
+    /* Only the populated rows are scanned, so clear every row that either table may have used */
+    NumTblRows = HK_CountCopyTableRows(CpyTblPtr);
+    if (HK_AppData.NumCopyTableRows > NumTblRows)
+    {
+        NumClearRows = HK_AppData.NumCopyTableRows;
+    }
+    else
+    {
+        NumClearRows = NumTblRows;
+    }
+
+    HK_AppData.NumCopyTableRows = NumTblRows;
+
+    /* Loop thru the RunTime table initializing the fields */
+    for (Loop = 0; Loop < NumClearRows; Loop++)
+    {
+        RtTblEntry = &RtTblPtr[Loop];
+
+        RtTblEntry->OutputPktAddr      = CFE_ES_MEMADDRESS_C(0);
+        RtTblEntry->InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
+        RtTblEntry->DataPresent        = HK_DATA_NOT_PRESENT;
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+        HK_AppData.CarryRow[Loop] = HK_NO_PREV_ROW;
+#endif
+    }
+
+    /* Group the rows by output MsgId, the output list is rebuilt by HK_BuildOutputIndex below */
+    RowList = HK_AppData.OutputEntryList;
+    NumRows = 0;
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[Loop].OutputMid))
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareOutputMid);
+
+#if HK_OUTPUT_ARENA == 1
+    /* The packets of the previous table went with it, carve the new ones from the start of the pool */
+    HK_AppData.ArenaUsed = 0;
+#endif
+
+    /* Build one SB packet per output MsgId, sized to the byte furthest from the packet start */
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        MidOfThisPacket  = CpyTblPtr[RowList[GroupStart]].OutputMid;
+        SizeOfThisPacket = 0;
+        HasInput         = false;
+
+        for (GroupEnd = GroupStart; GroupEnd < NumRows; GroupEnd++)
+        {
+            CpyTblEntry = &CpyTblPtr[RowList[GroupEnd]];
+
+            if (!CFE_SB_MsgId_Equal(CpyTblEntry->OutputMid, MidOfThisPacket))
+            {
+                break;
+            }
+
+            FurthestByteFromThisEntry = CpyTblEntry->OutputOffset + CpyTblEntry->NumBytes;
+            if (FurthestByteFromThisEntry > SizeOfThisPacket)
+            {
+                SizeOfThisPacket = FurthestByteFromThisEntry;
+            }
+
+            if (CFE_SB_IsValidMsgId(CpyTblEntry->InputMid))
+            {
+                HasInput = true;
+            }
+        }
+
+        /* A packet is only needed if at least one of its entries has an input */
+        if (HasInput && (SizeOfThisPacket > 0))
+        {
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+            /* An unchanged packet keeps its buffer, and with it its data, from the previous table */
+            NewPacketAddr = HK_ReusePrevOutputPkt(CpyTblPtr, &RowList[GroupStart], GroupEnd - GroupStart);
+            if (NewPacketAddr != NULL)
+            {
+                for (Loop = GroupStart; Loop < GroupEnd; Loop++)
+                {
+                    RtTblPtr[RowList[Loop]].OutputPktAddr = CFE_ES_MEMADDRESS_C(NewPacketAddr);
+                }
+                continue;
+            }
+#endif
+
+            Result = HK_AllocOutputPkt(&NewPacketAddr, SizeOfThisPacket);
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+            /* Without room for both tables, give up carrying the data of the packets that are not kept */
+            if ((Result < CFE_SUCCESS) && HK_FreePrevOutputPkts())
+            {
+                Result = HK_AllocOutputPkt(&NewPacketAddr, SizeOfThisPacket);
+            }
+#endif
+
+            if (Result >= CFE_SUCCESS)
+            {
+                /* Assign the packet to every entry in the group */
+                for (Loop = GroupStart; Loop < GroupEnd; Loop++)
+                {
+                    RtTblPtr[RowList[Loop]].OutputPktAddr = CFE_ES_MEMADDRESS_C(NewPacketAddr);
+                }
+
+                /* Init the SB Packet only once regardless of how many times its in the table */
+                CFE_MSG_Init(&NewPacketAddr->Msg, MidOfThisPacket, SizeOfThisPacket);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HK_MEM_POOL_MALLOC_FAILED_EID, CFE_EVS_EventType_ERROR,
+                                  "HK Processing New Table: ES_GetPoolBuf for size %d returned 0x%04X",
+                                  (int)SizeOfThisPacket, (unsigned int)Result);
+            }
+        }
+    }
+
+    /* Group the rows by input MsgId, the input list is rebuilt by HK_BuildInputIndex below */
+    RowList = HK_AppData.InputEntryList;
+    NumRows = 0;
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (CFE_SB_IsValidMsgId(CpyTblPtr[Loop].InputMid))
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareInputMid);
+
+    /* Subscribe once per input MsgId and mark every duplicate as subscribed */
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        CpyTblEntry = &CpyTblPtr[RowList[GroupStart]];
+
+        for (GroupEnd = GroupStart + 1; GroupEnd < NumRows; GroupEnd++)
+        {
+            if (!CFE_SB_MsgId_Equal(CpyTblPtr[RowList[GroupEnd]].InputMid, CpyTblEntry->InputMid))
+            {
+                break;
+            }
+        }
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+        /* A MsgId the previous table subscribed to stays subscribed */
+        if (HK_KeepPrevSubscription(CpyTblEntry))
+        {
+            Result = CFE_SUCCESS;
+        }
+        else
+#endif
+        {
+            Result = CFE_SB_Subscribe(CpyTblEntry->InputMid, HK_AppData.CmdPipe);
+        }
+
+        if (Result == CFE_SUCCESS)
+        {
+            for (Loop = GroupStart; Loop < GroupEnd; Loop++)
+            {
+                RtTblPtr[RowList[Loop]].InputMidSubscribed = HK_INPUTMID_SUBSCRIBED;
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(HK_CANT_SUBSCRIBE_TO_SB_PKT_EID, CFE_EVS_EventType_ERROR,
+                              "HK Processing New Table:SB_Subscribe for Mid 0x%08lX returned 0x%04X",
+                              (unsigned long)CFE_SB_MsgIdToValue(CpyTblEntry->InputMid), (unsigned int)Result);
+        }
+    }
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+    /* Free what the previous table used and this one did not take over */
+    HK_CarryPrevData(CpyTblPtr, RtTblPtr);
+    HK_ReleaseCopyTableRows(HK_AppData.PrevCopyTable, HK_AppData.PrevRuntimeTable, HK_AppData.NumPrevRows);
+#endif
+
+    /* Now that the output packets exist, index the rows by input and output MsgId */
+    HK_BuildInputIndex(CpyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CpyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CpyTblPtr, RtTblPtr);
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+    HK_RestoreCarriedData();
+    HK_AppData.NumPrevRows = 0;
+#endif
+
+#if HK_GENERATED_COPY == 1
+    HK_AppData.GenCopyActive = HK_MatchGenCopyTable(CpyTblPtr, RtTblPtr, HK_GenCopyTable, HK_GenCopyTableRows);
+    if (HK_AppData.GenCopyActive)
+    {
+        CFE_EVS_SendEvent(HK_GEN_COPY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "HK Processing New Table: using the generated copy routine");
+    }
+    else
+    {
+        CFE_EVS_SendEvent(HK_GEN_COPY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "HK Processing New Table: table differs from the generated copy routine, interpreting it");
+    }
+#endif
+
+#if HK_INPUT_STATS == 1
+    HK_ResetInputStats();
+#endif
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    /* Every new packet starts without a spare buffer */
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        HK_QueueSpareRefill(&HK_AppData.OutputPkts[Loop]);
+    }
+    HK_RefillSpareBuffers();
+#endif
+
+#if HK_SCHEDULED_OUTPUT == 1
+    HK_ApplySendSchedTable();
+#endif
+
+    CFE_ES_PerfLogExit(HK_NEW_COPY_TABLE_PERF_ID);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK check the copy table against the generated copy routine      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_MatchGenCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr,
+                          const HK_CopyTableEntry_t *GenTblPtr, uint16 GenNumRows)
+{
+    const HK_CopyTableEntry_t *CpyTblEntry;
+    const HK_CopyTableEntry_t *GenTblEntry;
+    uint16                     Loop;
+
+    if (HK_AppData.NumCopyTableRows != GenNumRows)
+    {
+        return false;
+    }
+
+    for (Loop = 0; Loop < GenNumRows; Loop++)
+    {
+        CpyTblEntry = &CpyTblPtr[Loop];
+        GenTblEntry = &GenTblPtr[Loop];
+
+        if (!CFE_SB_MsgId_Equal(CpyTblEntry->InputMid, GenTblEntry->InputMid) ||
+            !CFE_SB_MsgId_Equal(CpyTblEntry->OutputMid, GenTblEntry->OutputMid) ||
+            (CpyTblEntry->InputOffset != GenTblEntry->InputOffset) ||
+            (CpyTblEntry->OutputOffset != GenTblEntry->OutputOffset) ||
+            (CpyTblEntry->NumBytes != GenTblEntry->NumBytes))
+        {
+            return false;
+        }
+
+        /* The generated routine writes to every row it has, so every output packet must exist */
+        if (CFE_SB_IsValidMsgId(CpyTblEntry->InputMid) && CFE_SB_IsValidMsgId(CpyTblEntry->OutputMid) &&
+            (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr) == NULL))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK Tear down old copy table                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_TearDownOldCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    /* Ensure that the input arguments are valid */
+    if (((void *)CpyTblPtr == NULL) || ((void *)RtTblPtr == NULL))
+    {
+        CFE_EVS_SendEvent(HK_NULL_POINTER_TEARCPY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Null pointer detected in copy tbl tear down: CpyTbl = %p, RtTbl = %p", (void *)CpyTblPtr,
+                          (void *)RtTblPtr);
+        return HK_NULL_POINTER_DETECTED;
+    }
+
+    CFE_ES_PerfLogEntry(HK_TEARDOWN_PERF_ID);
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    HK_ReleaseSpareBuffers();
+#endif
+#if HK_SCHEDULED_OUTPUT == 1
+    HK_ReleaseLastSentData();
+#endif
+
+    /* No input message may be dispatched to the packets that are about to be freed */
+    HK_AppData.NumInputIndexEntries = 0;
+    HK_AppData.NumCopyOps           = 0;
+    HK_AppData.NumOutputPkts        = 0;
+
+    HK_ReleaseCopyTableRows(CpyTblPtr, RtTblPtr, HK_AppData.NumCopyTableRows);
+
+    CFE_ES_PerfLogExit(HK_TEARDOWN_PERF_ID);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK free the packets and subscriptions of copy table rows        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_ReleaseCopyTableRows(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr, uint16 NumTblRows)
+{
+    HK_CopyTableEntry_t *CpyTblEntry;
+    uint16 *             RowList;
+    uint16               NumRows;
+    uint16               GroupStart;
+    uint16               GroupEnd;
+    uint16               Loop;
+    uint16               Loop2;
+    void *               OutputPktAddr = NULL;
+    CFE_Status_t         Result;
+
+    /* Group the entries that own a packet by output MsgId, the index lists are free to reuse now */
+    RowList = HK_AppData.OutputEntryList;
+    NumRows = 0;
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr) != NULL)
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareOutputMid);
+
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        CpyTblEntry = &CpyTblPtr[RowList[GroupStart]];
+
+        for (GroupEnd = GroupStart + 1; GroupEnd < NumRows; GroupEnd++)
+        {
+            if (!CFE_SB_MsgId_Equal(CpyTblPtr[RowList[GroupEnd]].OutputMid, CpyTblEntry->OutputMid))
+            {
+                break;
+            }
+        }
+
+        /* Free each distinct packet of the group once, normally there is only one */
+        for (Loop = GroupStart; Loop < GroupEnd; Loop++)
+        {
+            OutputPktAddr = CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[RowList[Loop]].OutputPktAddr);
+            if (OutputPktAddr == NULL)
+            {
+                continue;
+            }
+
+#if HK_ZERO_COPY_SEND == 1
+            Result = CFE_SB_ReleaseMessageBuffer(OutputPktAddr);
+#elif HK_OUTPUT_ARENA == 1
+            /* Carved packets are given back all at once when the next table is processed */
+            Result = CFE_SUCCESS;
+#else
+            Result = CFE_ES_PutPoolBuf(HK_AppData.MemPoolHandle, (uint32 *)OutputPktAddr);
+#endif
+            if (Result < CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(HK_MEM_POOL_FREE_FAILED_EID, CFE_EVS_EventType_ERROR,
+                                  "HK TearDown: ES_putPoolBuf Err pkt:0x%08lX ret 0x%04X, hdl 0x%08lx",
+                                  (unsigned long)OutputPktAddr, (unsigned int)Result,
+                                  CFE_RESOURCEID_TO_ULONG(HK_AppData.MemPoolHandle));
+            }
+
+            /* NULL out the table entries of the packet, also when the free failed, so it is only tried once */
+            for (Loop2 = Loop; Loop2 < GroupEnd; Loop2++)
+            {
+                if (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[RowList[Loop2]].OutputPktAddr) == OutputPktAddr)
+                {
+                    RtTblPtr[RowList[Loop2]].OutputPktAddr = CFE_ES_MEMADDRESS_C(0);
+                }
+            }
+        }
+    }
+
+    /* Group the subscribed entries by input MsgId.  We don't have to worry about leaving
+       any Mid's subscribed since the entire table is getting clobbered. */
+    RowList = HK_AppData.InputEntryList;
+    NumRows = 0;
+    for (Loop = 0; Loop < NumTblRows; Loop++)
+    {
+        if (RtTblPtr[Loop].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            RowList[NumRows] = Loop;
+            NumRows++;
+        }
+    }
+
+    HK_SortEntryList(RowList, NumRows, CpyTblPtr, HK_CompareInputMid);
+
+    for (GroupStart = 0; GroupStart < NumRows; GroupStart = GroupEnd)
+    {
+        CpyTblEntry = &CpyTblPtr[RowList[GroupStart]];
+
+        CFE_SB_Unsubscribe(CpyTblEntry->InputMid, HK_AppData.CmdPipe);
+
+        for (GroupEnd = GroupStart; GroupEnd < NumRows; GroupEnd++)
+        {
+            if (!CFE_SB_MsgId_Equal(CpyTblPtr[RowList[GroupEnd]].InputMid, CpyTblEntry->InputMid))
+            {
+                break;
+            }
+
+            RtTblPtr[RowList[GroupEnd]].InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
+        }
+    }
+}
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK save the copy table that is about to be replaced             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_SavePrevCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    uint16 NumRows = HK_AppData.NumCopyTableRows;
+    uint16 Loop;
+
+    /* Ensure that the input arguments are valid */
+    if (((void *)CpyTblPtr == NULL) || ((void *)RtTblPtr == NULL))
+    {
+        CFE_EVS_SendEvent(HK_NULL_POINTER_TEARCPY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Null pointer detected in copy tbl save: CpyTbl = %p, RtTbl = %p", (void *)CpyTblPtr,
+                          (void *)RtTblPtr);
+        return HK_NULL_POINTER_DETECTED;
+    }
+
+    /* After an update that did not complete, the saved rows still hold the packets and subscriptions */
+    if (HK_AppData.NumPrevRows > 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    HK_ReleaseSpareBuffers();
+#endif
+#if HK_SCHEDULED_OUTPUT == 1
+    HK_ReleaseLastSentData();
+#endif
+
+    /* The data present flags are kept per row, the bit positions change with the new table */
+    HK_SyncDataPresentFlags(RtTblPtr);
+
+    memcpy(HK_AppData.PrevCopyTable, CpyTblPtr, NumRows * sizeof(HK_CopyTableEntry_t));
+    memcpy(HK_AppData.PrevRuntimeTable, RtTblPtr, NumRows * sizeof(HK_RuntimeTableEntry_t));
+
+    HK_AppData.NumPrevOutputRows = 0;
+    HK_AppData.NumPrevInputRows  = 0;
+
+    for (Loop = 0; Loop < NumRows; Loop++)
+    {
+        if (CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr) != NULL)
+        {
+#if HK_STALE_DATA_CHECK == 1
+            HK_AppData.PrevRefreshTime[Loop] = HK_AppData.RefreshTime[HK_AppData.OutputBitPos[Loop]];
+#endif
+
+            HK_AppData.PrevOutputList[HK_AppData.NumPrevOutputRows] = Loop;
+            HK_AppData.NumPrevOutputRows++;
+        }
+
+        if (RtTblPtr[Loop].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            HK_AppData.PrevInputList[HK_AppData.NumPrevInputRows] = Loop;
+            HK_AppData.NumPrevInputRows++;
+        }
+
+        /* The saved rows now own the packets and subscriptions */
+        RtTblPtr[Loop].OutputPktAddr      = CFE_ES_MEMADDRESS_C(0);
+        RtTblPtr[Loop].InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
+        RtTblPtr[Loop].DataPresent        = HK_DATA_NOT_PRESENT;
+    }
+
+    HK_SortEntryList(HK_AppData.PrevOutputList, HK_AppData.NumPrevOutputRows, HK_AppData.PrevCopyTable,
+                     HK_CompareOutputMid);
+    HK_SortEntryList(HK_AppData.PrevInputList, HK_AppData.NumPrevInputRows, HK_AppData.PrevCopyTable,
+                     HK_CompareInputMid);
+
+    HK_AppData.NumPrevRows = NumRows;
+
+    /* No input message may be dispatched until the new table is processed */
+    HK_AppData.NumInputIndexEntries = 0;
+    HK_AppData.NumCopyOps           = 0;
+    HK_AppData.NumOutputPkts        = 0;
+
+    return CFE_SUCCESS;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK allocate an output packet                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_AllocOutputPkt(CFE_SB_Buffer_t **BufPtr, size_t Size)
+{
+    CFE_Status_t Result;
+
+#if HK_ZERO_COPY_SEND == 1
+    /* The packet is built in an SB buffer so that it can be sent without a copy */
+    *BufPtr = CFE_SB_AllocateMessageBuffer(Size);
+    Result  = (*BufPtr != NULL) ? CFE_SUCCESS : CFE_SB_BUF_ALOC_ERR;
+#elif HK_OUTPUT_ARENA == 1
+    *BufPtr = HK_AllocArenaPkt(Size);
+    Result  = (*BufPtr != NULL) ? CFE_SUCCESS : CFE_ES_ERR_MEM_BLOCK_SIZE;
+#else
+    *BufPtr = NULL;
+    Result  = CFE_ES_GetPoolBuf((void **)BufPtr, HK_AppData.MemPoolHandle, Size);
+#endif
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK carve an output packet from the memory pool buffer           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_SB_Buffer_t *HK_AllocArenaPkt(size_t Size)
+{
+    CFE_SB_Buffer_t *Buffer;
+    size_t           BlockSize = HK_OUTPUT_BLOCK_SIZE(Size);
+
+    if (BlockSize > (sizeof(HK_AppData.MemPoolBuffer.Data) - HK_AppData.ArenaUsed))
+    {
+        return NULL;
+    }
+
+    Buffer = (CFE_SB_Buffer_t *)&HK_AppData.MemPoolBuffer.Data[HK_AppData.ArenaUsed];
+    HK_AppData.ArenaUsed += BlockSize;
+
+    return Buffer;
+}
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK take over an unchanged output packet of the previous table   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_SB_Buffer_t *HK_ReusePrevOutputPkt(const HK_CopyTableEntry_t *CpyTblPtr, const uint16 *EntryList, uint16 NumEntries)
+{
+    const HK_CopyTableEntry_t *NewEntry;
+    const HK_CopyTableEntry_t *PrevEntry;
+    const uint16 *             PrevList = HK_AppData.PrevOutputList;
+    uint16                     NumPrev  = HK_AppData.NumPrevOutputRows;
+    uint16                     First;
+    uint16                     Loop;
+
+    First = HK_LowerBoundEntryList(PrevList, NumPrev, HK_AppData.PrevCopyTable, &CpyTblPtr[EntryList[0]],
+                                   HK_CompareOutputMid);
+
+    /* The previous packet must have exactly as many rows */
+    if (((First + NumEntries) > NumPrev) ||
+        (((First + NumEntries) < NumPrev) &&
+         CFE_SB_MsgId_Equal(HK_AppData.PrevCopyTable[PrevList[First + NumEntries]].OutputMid,
+                            CpyTblPtr[EntryList[0]].OutputMid)))
+    {
+        return NULL;
+    }
+
+    /* ...and the same rows in the same order */
+    for (Loop = 0; Loop < NumEntries; Loop++)
+    {
+        NewEntry  = &CpyTblPtr[EntryList[Loop]];
+        PrevEntry = &HK_AppData.PrevCopyTable[PrevList[First + Loop]];
+
+        if (!CFE_SB_MsgId_Equal(NewEntry->OutputMid, PrevEntry->OutputMid) ||
+            !CFE_SB_MsgId_Equal(NewEntry->InputMid, PrevEntry->InputMid) ||
+            (NewEntry->InputOffset != PrevEntry->InputOffset) || (NewEntry->OutputOffset != PrevEntry->OutputOffset) ||
+            (NewEntry->NumBytes != PrevEntry->NumBytes))
+        {
+            return NULL;
+        }
+    }
+
+    /* A packet freed to make room for the new table cannot be kept */
+    if (CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[PrevList[First]].OutputPktAddr) == NULL)
+    {
+        return NULL;
+    }
+
+    /* Each new row keeps the data of its saved row */
+    for (Loop = 0; Loop < NumEntries; Loop++)
+    {
+        HK_AppData.CarryRow[EntryList[Loop]] = PrevList[First + Loop];
+    }
+
+    return CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[PrevList[First]].OutputPktAddr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK free the previous packets that the new table does not keep   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_FreePrevOutputPkts(void)
+{
+    HK_RuntimeTableEntry_t *PrevRtTbl = HK_AppData.PrevRuntimeTable;
+    const uint16 *          PrevList  = HK_AppData.PrevOutputList;
+    void *                  PrevPkt;
+    uint16                  Loop;
+    uint16                  Loop2;
+    bool                    Freed = false;
+    CFE_Status_t            Result;
+
+    /* The packets kept so far belong to the new table now */
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        if (HK_AppData.CarryRow[Loop] != HK_NO_PREV_ROW)
+        {
+            PrevRtTbl[HK_AppData.CarryRow[Loop]].OutputPktAddr = CFE_ES_MEMADDRESS_C(0);
+        }
+    }
+
+    for (Loop = 0; Loop < HK_AppData.NumPrevOutputRows; Loop++)
+    {
+        PrevPkt = CFE_ES_MEMADDRESS_TO_PTR(PrevRtTbl[PrevList[Loop]].OutputPktAddr);
+        if (PrevPkt == NULL)
+        {
+            continue;
+        }
+
+#if HK_ZERO_COPY_SEND == 1
+        Result = CFE_SB_ReleaseMessageBuffer(PrevPkt);
+#else
+        Result = CFE_ES_PutPoolBuf(HK_AppData.MemPoolHandle, PrevPkt);
+#endif
+        if (Result < CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HK_MEM_POOL_FREE_FAILED_EID, CFE_EVS_EventType_ERROR,
+                              "HK TearDown: ES_putPoolBuf Err pkt:0x%08lX ret 0x%04X, hdl 0x%08lx",
+                              (unsigned long)PrevPkt, (unsigned int)Result,
+                              CFE_RESOURCEID_TO_ULONG(HK_AppData.MemPoolHandle));
+        }
+
+        /* The saved rows are in output MsgId order, so the other rows of the packet follow */
+        for (Loop2 = Loop; Loop2 < HK_AppData.NumPrevOutputRows; Loop2++)
+        {
+            if (CFE_ES_MEMADDRESS_TO_PTR(PrevRtTbl[PrevList[Loop2]].OutputPktAddr) == PrevPkt)
+            {
+                PrevRtTbl[PrevList[Loop2]].OutputPktAddr = CFE_ES_MEMADDRESS_C(0);
+            }
+        }
+
+        Freed = true;
+    }
+
+    return Freed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK keep a subscription of the previous table                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_KeepPrevSubscription(const HK_CopyTableEntry_t *CpyTblEntry)
+{
+    const uint16 *PrevList = HK_AppData.PrevInputList;
+    uint16        NumPrev  = HK_AppData.NumPrevInputRows;
+    uint16        First;
+    uint16        Loop;
+
+    First = HK_LowerBoundEntryList(PrevList, NumPrev, HK_AppData.PrevCopyTable, CpyTblEntry, HK_CompareInputMid);
+
+    /* The subscription no longer belongs to the saved rows */
+    Loop = First;
+    while ((Loop < NumPrev) &&
+           CFE_SB_MsgId_Equal(HK_AppData.PrevCopyTable[PrevList[Loop]].InputMid, CpyTblEntry->InputMid))
+    {
+        HK_AppData.PrevRuntimeTable[PrevList[Loop]].InputMidSubscribed = HK_INPUTMID_NOT_SUBSCRIBED;
+        Loop++;
+    }
+
+    return (Loop > First);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK carry the data of the previous table into changed packets    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_CarryPrevData(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    const HK_CopyTableEntry_t *CpyTblEntry;
+    const HK_CopyTableEntry_t *PrevEntry;
+    const uint16 *             PrevList = HK_AppData.PrevInputList;
+    uint16                     NumPrev  = HK_AppData.NumPrevInputRows;
+    uint8 *                    OutputPkt;
+    uint8 *                    PrevPkt;
+    uint16                     PrevRow;
+    uint16                     Match;
+    uint16                     Loop;
+
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        CpyTblEntry = &CpyTblPtr[Loop];
+        OutputPkt   = CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr);
+
+        /* Rows of a kept packet already hold their data */
+        if ((OutputPkt == NULL) || (HK_AppData.CarryRow[Loop] != HK_NO_PREV_ROW))
+        {
+            continue;
+        }
+
+        /* Any saved row of the same input field with data present holds its latest value */
+        Match = HK_LowerBoundEntryList(PrevList, NumPrev, HK_AppData.PrevCopyTable, CpyTblEntry, HK_CompareInputMid);
+        while ((Match < NumPrev) &&
+               CFE_SB_MsgId_Equal(HK_AppData.PrevCopyTable[PrevList[Match]].InputMid, CpyTblEntry->InputMid))
+        {
+            PrevRow   = PrevList[Match];
+            PrevEntry = &HK_AppData.PrevCopyTable[PrevRow];
+            PrevPkt   = CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[PrevRow].OutputPktAddr);
+
+            if ((PrevEntry->InputOffset == CpyTblEntry->InputOffset) &&
+                (PrevEntry->NumBytes == CpyTblEntry->NumBytes) && (PrevPkt != NULL) &&
+                (HK_AppData.PrevRuntimeTable[PrevRow].DataPresent == HK_DATA_PRESENT))
+            {
+                memcpy(&OutputPkt[CpyTblEntry->OutputOffset], &PrevPkt[PrevEntry->OutputOffset],
+                       CpyTblEntry->NumBytes);
+                HK_AppData.CarryRow[Loop] = PrevRow;
+                break;
+            }
+
+            Match++;
+        }
+    }
+
+    /* A kept packet no longer belongs to the saved rows, a copied one still does */
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        PrevRow = HK_AppData.CarryRow[Loop];
+        if (PrevRow == HK_NO_PREV_ROW)
+        {
+            continue;
+        }
+
+        PrevPkt = CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[PrevRow].OutputPktAddr);
+        if (PrevPkt == CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr))
+        {
+            HK_AppData.PrevRuntimeTable[PrevRow].OutputPktAddr = CFE_ES_MEMADDRESS_C(0);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK restore the data present flags of kept rows                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_RestoreCarriedData(void)
+{
+    uint16 PrevRow;
+    uint16 BitPos;
+    uint16 Loop;
+
+    for (Loop = 0; Loop < HK_AppData.NumCopyTableRows; Loop++)
+    {
+        PrevRow = HK_AppData.CarryRow[Loop];
+
+        if ((PrevRow != HK_NO_PREV_ROW) && (HK_AppData.PrevRuntimeTable[PrevRow].DataPresent == HK_DATA_PRESENT))
+        {
+            BitPos = HK_AppData.OutputBitPos[Loop];
+
+            HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] |=
+                (uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS);
+#if HK_STALE_DATA_CHECK == 1
+            HK_AppData.RefreshTime[BitPos] = HK_AppData.PrevRefreshTime[PrevRow];
+#endif
+        }
+    }
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK Send combined output message                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SendCombinedHkPacket(CFE_SB_MsgId_t WhichMidToSend)
+{
+    HK_OutputPktEntry_t *OutPkt = NULL;
+
+    CFE_ES_PerfLogEntry(HK_SEND_COMBINED_PERF_ID);
+
+    OutPkt = HK_FindOutputPkt(WhichMidToSend);
+
+    if (OutPkt != NULL)
+    {
+        HK_SendOutputPkt(OutPkt, false);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(HK_UNKNOWN_COMBINED_PACKET_EID, CFE_EVS_EventType_INFORMATION,
+                          "Combined HK Packet 0x%08lX is not found in current HK Copy Table",
+                          (unsigned long)CFE_SB_MsgIdToValue(WhichMidToSend));
+    }
+
+    CFE_ES_PerfLogExit(HK_SEND_COMBINED_PERF_ID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK send the selected combined output messages in one pass       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 HK_SendAllCombinedPackets(const CFE_SB_MsgId_t *MsgIds, uint16 NumMsgIds)
+{
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               Loop;
+    uint16               NumSent = 0;
+
+    CFE_ES_PerfLogEntry(HK_SEND_COMBINED_PERF_ID);
+
+    if (NumMsgIds == 0)
+    {
+        for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+        {
+            if (HK_SendOutputPkt(&HK_AppData.OutputPkts[Loop], false))
+            {
+                NumSent++;
+            }
+        }
+    }
+    else
+    {
+        for (Loop = 0; Loop < NumMsgIds; Loop++)
+        {
+            OutPkt = HK_FindOutputPkt(MsgIds[Loop]);
+
+            if (OutPkt == NULL)
+            {
+                CFE_EVS_SendEvent(HK_UNKNOWN_COMBINED_PACKET_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Combined HK Packet 0x%08lX is not found in current HK Copy Table",
+                                  (unsigned long)CFE_SB_MsgIdToValue(MsgIds[Loop]));
+            }
+            else if (HK_SendOutputPkt(OutPkt, false))
+            {
+                NumSent++;
+            }
+        }
+    }
+
+    CFE_ES_PerfLogExit(HK_SEND_COMBINED_PERF_ID);
+
+    return NumSent;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK send one combined output message                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_SendOutputPkt(HK_OutputPktEntry_t *OutPkt, bool SendIncomplete)
+{
+    CFE_SB_MsgId_t InputMidMissing = CFE_SB_INVALID_MSG_ID;
+    uint16         NumMissing      = 0;
+    bool           MissingData;
+    bool           Sent = false;
+    CFE_Status_t   Status;
+#if HK_STALE_DATA_CHECK == 1
+    CFE_SB_MsgId_t InputMidStale = CFE_SB_INVALID_MSG_ID;
+    uint16         NumStale;
+#endif
+#if HK_TIMING_STATS == 1
+    CFE_TIME_SysTime_t StartTime = CFE_TIME_GetMET();
+    uint32             ElapsedTime;
+#endif
+
+    MissingData = (HK_CheckForMissingData(OutPkt, &InputMidMissing, &NumMissing) == HK_MISSING_DATA_DETECTED);
+    if (MissingData)
+    {
+        HK_AppData.MissingDataCtr++;
+
+        CFE_EVS_SendEvent(HK_OUTPKT_MISSING_DATA_EID, CFE_EVS_EventType_DEBUG,
+                          "Combined Packet 0x%08lX missing data from Input Pkt 0x%08lX, %d of %d entries missing",
+                          (unsigned long)CFE_SB_MsgIdToValue(OutPkt->OutputMid),
+                          (unsigned long)CFE_SB_MsgIdToValue(InputMidMissing), (int)NumMissing,
+                          (int)OutPkt->NumEntries);
+    }
+    /* An incomplete packet that discards is only sent when the caller asks for it */
+    if (!MissingData || SendIncomplete || !OutPkt->DiscardIncomplete)
+    {
+#if HK_STALE_DATA_CHECK == 1
+        NumStale = HK_DropStaleData(OutPkt, &InputMidStale);
+        if (NumStale != 0)
+        {
+            CFE_EVS_SendEvent(HK_OUTPKT_STALE_DATA_EID, CFE_EVS_EventType_DEBUG,
+                              "Combined Packet 0x%08lX stale data from Input Pkt 0x%08lX, %d of %d entries dropped",
+                              (unsigned long)CFE_SB_MsgIdToValue(OutPkt->OutputMid),
+                              (unsigned long)CFE_SB_MsgIdToValue(InputMidStale), (int)NumStale,
+                              (int)OutPkt->NumEntries);
+        }
+#endif
+
+        if (HK_SkipUnchangedPkt(OutPkt))
+        {
+            HK_AppData.UnchangedPktsSkipped++;
+        }
+        else
+        {
+            /* Send the combined housekeeping telemetry packet...        */
+#if HK_ZERO_COPY_SEND == 1
+            Status = HK_TransmitOutputPktBuffer(OutPkt);
+#else
+            CFE_SB_TimeStampMsg(&OutPkt->OutBuffer->Msg);
+            Status = CFE_SB_TransmitMsg(&OutPkt->OutBuffer->Msg, true);
+#endif
+
+            if (Status == CFE_SUCCESS)
+            {
+                HK_AppData.CombinedPacketsSent++;
+                Sent = true;
+            }
+            else
+            {
+                /* The data copied as last sent never went out, so the next request sends */
+                OutPkt->SkippedSends = OutPkt->Heartbeat;
+
+                CFE_EVS_SendEvent(HK_OUTPKT_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Combined Packet 0x%08lX send failed, RC=0x%08lX",
+                                  (unsigned long)CFE_SB_MsgIdToValue(OutPkt->OutputMid), (unsigned long)Status);
+            }
+        }
+    }
+
+    HK_SetFlagsToNotPresent(OutPkt);
+    OutPkt->WakeupsSinceSend = 0;
+
+#if HK_TIMING_STATS == 1
+    ElapsedTime = HK_GetElapsedSubsecs(StartTime);
+    if (ElapsedTime > HK_AppData.MaxSendTime)
+    {
+        HK_AppData.MaxSendTime = ElapsedTime;
+    }
+#endif
+
+    return Sent;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK hand a combined output packet buffer off to SB               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t HK_TransmitOutputPktBuffer(HK_OutputPktEntry_t *OutPkt)
+{
+    CFE_SB_Buffer_t *OldBuffer = OutPkt->OutBuffer;
+    CFE_SB_Buffer_t *NewBuffer;
+    HK_CopyOp_t *    CopyOp;
+    uint16           Loop;
+    CFE_Status_t     Status;
+
+    CFE_SB_TimeStampMsg(&OldBuffer->Msg);
+
+    /* A spare buffer is already initialized, only allocate when there is none */
+    NewBuffer           = OutPkt->SpareBuffer;
+    OutPkt->SpareBuffer = NULL;
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    HK_QueueSpareRefill(OutPkt);
+#endif
+    if (NewBuffer == NULL)
+    {
+        NewBuffer = CFE_SB_AllocateMessageBuffer(OutPkt->PacketSize);
+
+        /* Without a buffer to continue in, send a copy and keep building in this one */
+        if (NewBuffer == NULL)
+        {
+            return CFE_SB_TransmitMsg(&OldBuffer->Msg, true);
+        }
+
+        CFE_MSG_Init(&NewBuffer->Msg, OutPkt->OutputMid, OutPkt->PacketSize);
+    }
+
+    /* A packet that can go out with missing data must keep the last values, as with a copy send */
+    if ((!OutPkt->DiscardIncomplete || (OutPkt->CompleteTimeout != 0)) && (OutPkt->PacketSize > HK_OUTPUT_HDR_SIZE))
+    {
+        memcpy((uint8 *)NewBuffer + HK_OUTPUT_HDR_SIZE, (const uint8 *)OldBuffer + HK_OUTPUT_HDR_SIZE,
+               OutPkt->PacketSize - HK_OUTPUT_HDR_SIZE);
+    }
+
+    /* The buffer still belongs to HK if SB did not accept it, keep the new one as a spare */
+    Status = CFE_SB_TransmitBuffer(OldBuffer, true);
+    if (Status != CFE_SUCCESS)
+    {
+        OutPkt->SpareBuffer = NewBuffer;
+        return Status;
+    }
+
+    OutPkt->OutBuffer = NewBuffer;
+
+    /* Point the rows and copy operations of this packet at the new buffer */
+    for (Loop = 0; Loop < OutPkt->NumEntries; Loop++)
+    {
+        HK_AppData.RuntimeTablePtr[HK_AppData.OutputEntryList[OutPkt->FirstEntry + Loop]].OutputPktAddr =
+            CFE_ES_MEMADDRESS_C(NewBuffer);
+    }
+
+    for (Loop = 0; Loop < OutPkt->NumOps; Loop++)
+    {
+        CopyOp          = &HK_AppData.CopyOps[HK_AppData.PktOpList[OutPkt->FirstOp + Loop]];
+        CopyOp->DestPtr = (uint8 *)NewBuffer + (CopyOp->DestPtr - (uint8 *)OldBuffer);
+    }
+
+    return CFE_SUCCESS;
+}
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK list an output packet for a spare buffer refill              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_QueueSpareRefill(HK_OutputPktEntry_t *OutPkt)
+{
+    /* Each packet is listed once, so the list never holds more than the packets */
+    if (!OutPkt->SpareQueued)
+    {
+        OutPkt->SpareQueued                                    = true;
+        HK_AppData.SpareRefillList[HK_AppData.NumSpareRefills] = (uint16)(OutPkt - HK_AppData.OutputPkts);
+        HK_AppData.NumSpareRefills++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK replace the used spare output packet buffers                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_RefillSpareBuffers(void)
+{
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               Loop;
+
+    /* Only the packets listed since the last refill can be missing a spare */
+    for (Loop = 0; Loop < HK_AppData.NumSpareRefills; Loop++)
+    {
+        OutPkt              = &HK_AppData.OutputPkts[HK_AppData.SpareRefillList[Loop]];
+        OutPkt->SpareQueued = false;
+
+        if (OutPkt->SpareBuffer == NULL)
+        {
+            OutPkt->SpareBuffer = CFE_SB_AllocateMessageBuffer(OutPkt->PacketSize);
+            if (OutPkt->SpareBuffer != NULL)
+            {
+                CFE_MSG_Init(&OutPkt->SpareBuffer->Msg, OutPkt->OutputMid, OutPkt->PacketSize);
+            }
+        }
+    }
+
+    HK_AppData.NumSpareRefills = 0;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK release the spare output packet buffers                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_ReleaseSpareBuffers(void)
+{
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               Loop;
+
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        OutPkt = &HK_AppData.OutputPkts[Loop];
+
+        if (OutPkt->SpareBuffer != NULL)
+        {
+            CFE_SB_ReleaseMessageBuffer(OutPkt->SpareBuffer);
+            OutPkt->SpareBuffer = NULL;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the status of HK tables and perform any necessary action. */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_CheckStatusOfTables(void)
+{
+    int32 HKStatus;
+
+    CFE_ES_PerfLogEntry(HK_CHECK_TABLES_PERF_ID);
+
+    HKStatus = HK_CheckStatusOfCopyTable();
 
     /* Only check the Dump Table if there were no problems with the Copy Table */
     if (HKStatus == HK_SUCCESS)
     {
-        HKStatus = HK_CheckStatusOfDumpTable();
+        HKStatus = HK_CheckStatusOfDumpTable();
+    }
+
+#if HK_SCHEDULED_OUTPUT == 1
+    HK_CheckStatusOfSendSchedTable();
+#endif
+
+#if HK_INPUT_STATS == 1
+    HK_CheckStatusOfInputStatsTable();
+#endif
+
+    CFE_ES_PerfLogExit(HK_CHECK_TABLES_PERF_ID);
+
+    return HKStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                     */
+/* Check the status of HK Copy table and perform any necessary action. */
+/*                                                                     */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_CheckStatusOfCopyTable(void)
+{
+    int32 Status;
+    int32 HKStatus = HK_ERROR; /* Assume failure */
+#if HK_TIMING_STATS == 1
+    CFE_TIME_SysTime_t StartTime;
+    uint32             ElapsedTime;
+#endif
+
+    /* Determine if the copy table has a validation or update that needs to be performed */
+    Status = CFE_TBL_GetStatus(HK_AppData.CopyTableHandle);
+
+    if (Status == CFE_TBL_INFO_VALIDATION_PENDING)
+    {
+        /* Validate the specified Table */
+        Status = CFE_TBL_Validate(HK_AppData.CopyTableHandle);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HK_UNEXPECTED_TBLVLD_RET_EID, CFE_EVS_EventType_ERROR,
+                              "Unexpected CFE_TBL_Validate return (0x%08X) for Copy Table", (unsigned int)Status);
+        }
+        HKStatus = HK_SUCCESS; /* This could just be a bad table, so no reason to abort the app */
+    }
+    else if (Status == CFE_TBL_INFO_UPDATE_PENDING)
+    {
+#if HK_TIMING_STATS == 1
+        StartTime = CFE_TIME_GetMET();
+#endif
+
+        /* Unsubscribe to input msgs and free out pkt buffers */
+        /* If the copy table pointer is bad, that's okay here because it will be re-allocated later.
+           If the runtime table pointer is bad, the process new copy table call later on will
+           flag the error.  So we can ignore the return status at this point.
+        */
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+        /* The packets and subscriptions are kept until the new table has taken over the ones it uses */
+        HK_SavePrevCopyTable(HK_AppData.CopyTablePtr, HK_AppData.RuntimeTablePtr);
+#else
+        HK_TearDownOldCopyTable(HK_AppData.CopyTablePtr, HK_AppData.RuntimeTablePtr);
+#endif
+
+        /* release address must be called for update to take. */
+        Status = CFE_TBL_ReleaseAddress(HK_AppData.CopyTableHandle);
+
+        /* Releasing the address should only return CFE_SUCCESS at this point since we
+           already had an update-pending response earlier */
+        if (Status == CFE_SUCCESS)
+        {
+            /* Update the copy table */
+            Status = CFE_TBL_Update(HK_AppData.CopyTableHandle);
+
+            if (Status == CFE_SUCCESS)
+            {
+                /* Get address of the newly updated copy table. */
+                Status = CFE_TBL_GetAddress((void *)(&HK_AppData.CopyTablePtr), HK_AppData.CopyTableHandle);
+
+                /* Status should only be CFE_TBL_INFO_UPDATED because we updated it above */
+                if (Status == CFE_TBL_INFO_UPDATED)
+                {
+                    Status = HK_ProcessNewCopyTable(HK_AppData.CopyTablePtr, HK_AppData.RuntimeTablePtr);
+
+                    if (Status == CFE_SUCCESS)
+                    {
+                        HKStatus = HK_SUCCESS;
+                    }
+                    else
+                    {
+                        /* If status was not success, then the copy table function received a NULL pointer argument */
+                        CFE_EVS_SendEvent(HK_NEWCPYTBL_HK_FAILED_EID, CFE_EVS_EventType_CRITICAL,
+                                          "Process New Copy Table Failed, status = 0x%08X", (unsigned int)Status);
+                    }
+                }
+                else
+                {
+                    CFE_EVS_SendEvent(HK_UNEXPECTED_GETADDR_RET_EID, CFE_EVS_EventType_CRITICAL,
+                                      "Unexpected CFE_TBL_GetAddress return (0x%08X) for Copy Table",
+                                      (unsigned int)Status);
+                }
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HK_UNEXPECTED_TBLUPD_RET_EID, CFE_EVS_EventType_CRITICAL,
+                                  "Unexpected CFE_TBL_Update return (0x%08X) for Copy Table", (unsigned int)Status);
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(HK_UNEXPECTED_RELADDR_RET_EID, CFE_EVS_EventType_CRITICAL,
+                              "Unexpected CFE_TBL_ReleaseAddress return (0x%08X) for Copy Table", (unsigned int)Status);
+        }
+
+#if HK_TIMING_STATS == 1
+        ElapsedTime = HK_GetElapsedSubsecs(StartTime);
+        if (ElapsedTime > HK_AppData.MaxTableSwapTime)
+        {
+            HK_AppData.MaxTableSwapTime = ElapsedTime;
+        }
+#endif
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_UNEXPECTED_GETSTAT_RET_EID, CFE_EVS_EventType_CRITICAL,
+                          "Unexpected CFE_TBL_GetStatus return (0x%08X) for Copy Table", (unsigned int)Status);
+    }
+    else
+    {
+        /* Only way to get here is if Status == CFE_SUCCESS */
+        HKStatus = HK_SUCCESS;
+    }
+
+    return HKStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                     */
+/* Check the status of HK Dump table and perform any necessary action. */
+/*                                                                     */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_CheckStatusOfDumpTable(void)
+{
+    int32 Status;
+    int32 HKStatus = HK_ERROR; /* Assume failure */
+
+    /* Determine if the runtime table has a dump pending */
+    Status = CFE_TBL_GetStatus(HK_AppData.RuntimeTableHandle);
+
+    if (Status == CFE_TBL_INFO_DUMP_PENDING)
+    {
+        /* Bring the data present flags up to date from the bitset */
+        HK_SyncDataPresentFlags(HK_AppData.RuntimeTablePtr);
+
+        /* Dump the specified Table, cfe tbl manager makes copy */
+        Status = CFE_TBL_DumpToBuffer(HK_AppData.RuntimeTableHandle);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HK_UNEXPECTED_DUMPTOBUFFER_RET_EID, CFE_EVS_EventType_CRITICAL,
+                              "Unexpected CFE_TBL_DumpToBuffer return (0x%08X) for Runtime Table",
+                              (unsigned int)Status);
+        }
+        else
+        {
+            HKStatus = HK_SUCCESS;
+        }
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_UNEXPECTED_GETSTAT2_RET_EID, CFE_EVS_EventType_CRITICAL,
+                          "Unexpected CFE_TBL_GetStatus return (0x%08X) for Runtime Table", (unsigned int)Status);
+    }
+    else
+    {
+        /* Only way to get here is if Status == CFE_SUCCESS */
+        HKStatus = HK_SUCCESS;
+    }
+
+    return HKStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK Check for missing combined output message data               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_CheckForMissingData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *MissingInputMid, uint16 *NumMissing)
+{
+    int32  Status   = HK_NO_MISSING_DATA;
+    uint32 FirstBit = OutPkt->FirstEntry;
+    uint32 EndBit   = OutPkt->FirstEntry + OutPkt->NumEntries;
+    uint32 WordIdx;
+    uint32 MissingBits;
+    uint32 BitPos;
+
+    /* Compare the packet's received bits with the expected (all set) bits a word at a time */
+    for (WordIdx = FirstBit / HK_DATA_PRESENT_WORD_BITS; (WordIdx * HK_DATA_PRESENT_WORD_BITS) < EndBit; WordIdx++)
+    {
+        MissingBits = HK_GetDataPresentMask(WordIdx, FirstBit, EndBit) & ~HK_AppData.DataPresentBits[WordIdx];
+
+        if (MissingBits != 0)
+        {
+            if (Status == HK_NO_MISSING_DATA)
+            {
+                /* Report the input packet of the first missing entry */
+                BitPos = WordIdx * HK_DATA_PRESENT_WORD_BITS;
+                while ((MissingBits & ((uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS))) == 0)
+                {
+                    BitPos++;
+                }
+
+                *MissingInputMid = HK_AppData.CopyTablePtr[HK_AppData.OutputEntryList[BitPos]].InputMid;
+                *NumMissing      = 0;
+                Status           = HK_MISSING_DATA_DETECTED;
+            }
+
+            /* Count the missing entries */
+            while (MissingBits != 0)
+            {
+                MissingBits &= MissingBits - 1;
+                (*NumMissing)++;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK Set data present flags to 'data-not-present'                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SetFlagsToNotPresent(const HK_OutputPktEntry_t *OutPkt)
+{
+    uint32 FirstBit = OutPkt->FirstEntry;
+    uint32 EndBit   = OutPkt->FirstEntry + OutPkt->NumEntries;
+    uint32 WordIdx;
+
+    /* Clear the packet's range of the bitset a word at a time */
+    for (WordIdx = FirstBit / HK_DATA_PRESENT_WORD_BITS; (WordIdx * HK_DATA_PRESENT_WORD_BITS) < EndBit; WordIdx++)
+    {
+        HK_AppData.DataPresentBits[WordIdx] &= ~HK_GetDataPresentMask(WordIdx, FirstBit, EndBit);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK get the data present bitset mask of a word                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HK_GetDataPresentMask(uint32 WordIdx, uint32 FirstBit, uint32 EndBit)
+{
+    uint32 WordFirstBit = WordIdx * HK_DATA_PRESENT_WORD_BITS;
+    uint32 Mask         = 0xFFFFFFFF;
+
+    if (FirstBit > WordFirstBit)
+    {
+        Mask &= 0xFFFFFFFF << (FirstBit - WordFirstBit);
+    }
+
+    if (EndBit < (WordFirstBit + HK_DATA_PRESENT_WORD_BITS))
+    {
+        Mask &= ~(0xFFFFFFFF << (EndBit - WordFirstBit));
+    }
+
+    return Mask;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK copy the data present bitset into the run-time table         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SyncDataPresentFlags(HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    uint16 PktLoop;
+    uint16 BitPos;
+    uint16 EndBit;
+
+    for (PktLoop = 0; PktLoop < HK_AppData.NumOutputPkts; PktLoop++)
+    {
+        EndBit = HK_AppData.OutputPkts[PktLoop].FirstEntry + HK_AppData.OutputPkts[PktLoop].NumEntries;
+
+        for (BitPos = HK_AppData.OutputPkts[PktLoop].FirstEntry; BitPos < EndBit; BitPos++)
+        {
+            if (HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] &
+                ((uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS)))
+            {
+                RtTblPtr[HK_AppData.OutputEntryList[BitPos]].DataPresent = HK_DATA_PRESENT;
+            }
+            else
+            {
+                RtTblPtr[HK_AppData.OutputEntryList[BitPos]].DataPresent = HK_DATA_NOT_PRESENT;
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK send the combined output messages that are due               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SendScheduledPackets(void)
+{
+    const HK_SendSchedTableEntry_t *SchedEntry;
+    HK_OutputPktEntry_t *           OutPkt;
+    uint16                          Loop;
+
+    HK_AppData.WakeupCounter++;
+
+#if HK_SEND_WHEN_COMPLETE == 1
+    HK_CheckCompleteTimeouts();
+#endif
+
+    if (HK_AppData.SendSchedTablePtr == NULL)
+    {
+        return;
+    }
+
+    for (Loop = 0; Loop < HK_SEND_SCHED_TABLE_ENTRIES; Loop++)
+    {
+        SchedEntry = &HK_AppData.SendSchedTablePtr[Loop];
+
+        if ((SchedEntry->Period != 0) && ((HK_AppData.WakeupCounter % SchedEntry->Period) == SchedEntry->Phase))
+        {
+            /* A packet the current copy table does not build is skipped without an event */
+            OutPkt = HK_FindOutputPkt(SchedEntry->OutputMid);
+            if (OutPkt != NULL)
+            {
+                CFE_ES_PerfLogEntry(HK_SEND_COMBINED_PERF_ID);
+                HK_SendOutputPkt(OutPkt, false);
+                CFE_ES_PerfLogExit(HK_SEND_COMBINED_PERF_ID);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK validate the send schedule table                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HK_ValidateSendSchedTable(void *TblPtr)
+{
+    int32                     HKStatus = HK_SUCCESS;
+    int32                     i;
+    HK_SendSchedTableEntry_t *EntryPtr = (HK_SendSchedTableEntry_t *)TblPtr;
+    char                      IssueStringBuf[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    IssueStringBuf[0] = 0;
+
+    for (i = 0; i < HK_SEND_SCHED_TABLE_ENTRIES; i++)
+    {
+        /* Entries with all settings zero or default are not used */
+        if ((EntryPtr->Period != 0) || (EntryPtr->CompleteTimeout != 0) || (EntryPtr->StaleThreshold != 0) ||
+            (EntryPtr->IncompletePolicy != HK_INCOMPLETE_POLICY_DEFAULT) || (EntryPtr->Heartbeat != 0))
+        {
+            if (!CFE_SB_IsValidMsgId(EntryPtr->OutputMid))
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid Output MID: 0x%lx",
+                         (unsigned long)CFE_SB_MsgIdToValue(EntryPtr->OutputMid));
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            if ((EntryPtr->Period != 0) && (EntryPtr->Phase >= EntryPtr->Period))
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Phase %u not less than period %u",
+                         (unsigned int)EntryPtr->Phase, (unsigned int)EntryPtr->Period);
+                HKStatus = HK_ERROR;
+                break;
+            }
+
+            if (EntryPtr->IncompletePolicy > HK_INCOMPLETE_POLICY_DISCARD)
+            {
+                snprintf(IssueStringBuf, sizeof(IssueStringBuf), "Invalid incomplete packet policy %u",
+                         (unsigned int)EntryPtr->IncompletePolicy);
+                HKStatus = HK_ERROR;
+                break;
+            }
+        }
+
+        ++EntryPtr;
+    }
+
+    if (HKStatus != HK_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HK_SSTBL_VAL_ERR_EID, CFE_EVS_EventType_ERROR, "HK Send Schedule Validate: %s at entry index %d",
+                          IssueStringBuf, (int)i);
+    }
+
+    return HKStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK check the status of the send schedule table                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_CheckStatusOfSendSchedTable(void)
+{
+    CFE_Status_t Status;
+    bool         WasAvailable = (HK_AppData.SendSchedTablePtr != NULL);
+
+    /* Nothing to do unless a load or dump is pending or the table address was lost */
+    Status = CFE_TBL_GetStatus(HK_AppData.SendSchedTableHandle);
+    if ((Status == CFE_SUCCESS) && WasAvailable)
+    {
+        return;
+    }
+
+    /* The schedule is used as loaded, so cFE can validate and update it on its own */
+    CFE_TBL_ReleaseAddress(HK_AppData.SendSchedTableHandle);
+    CFE_TBL_Manage(HK_AppData.SendSchedTableHandle);
+
+    Status = CFE_TBL_GetAddress((void *)(&HK_AppData.SendSchedTablePtr), HK_AppData.SendSchedTableHandle);
+    if ((Status != CFE_SUCCESS) && (Status != CFE_TBL_INFO_UPDATED))
+    {
+        HK_AppData.SendSchedTablePtr = NULL;
+
+        /* Reported when the table is lost, not again on every check until it is back */
+        if (WasAvailable)
+        {
+            CFE_EVS_SendEvent(HK_SSTBL_GADR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Getting Adr for Send Schedule Table,RC=0x%08X", (unsigned int)Status);
+        }
+    }
+
+    /* The packet settings only change with the table, or when it is lost or comes back */
+    if ((Status == CFE_TBL_INFO_UPDATED) || (WasAvailable != (HK_AppData.SendSchedTablePtr != NULL)))
+    {
+        HK_ApplySendSchedTable();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK copy the complete timeouts into the output descriptors       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_ApplySendSchedTable(void)
+{
+    const HK_SendSchedTableEntry_t *SchedEntry;
+    HK_OutputPktEntry_t *           OutPkt;
+    uint16                          Loop;
+
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        HK_AppData.OutputPkts[Loop].CompleteTimeout   = 0;
+        HK_AppData.OutputPkts[Loop].WakeupsSinceSend  = 0;
+        HK_AppData.OutputPkts[Loop].StaleThreshold    = 0;
+        HK_AppData.OutputPkts[Loop].DiscardIncomplete = (HK_DISCARD_INCOMPLETE_COMBO == 1);
+        HK_AppData.OutputPkts[Loop].Heartbeat         = 0;
+    }
+
+    if (HK_AppData.SendSchedTablePtr == NULL)
+    {
+        return;
     }
 
-    return HKStatus;
+    for (Loop = 0; Loop < HK_SEND_SCHED_TABLE_ENTRIES; Loop++)
+    {
+        SchedEntry = &HK_AppData.SendSchedTablePtr[Loop];
+
+        if ((SchedEntry->CompleteTimeout != 0) || (SchedEntry->StaleThreshold != 0) ||
+            (SchedEntry->IncompletePolicy != HK_INCOMPLETE_POLICY_DEFAULT) || (SchedEntry->Heartbeat != 0))
+        {
+            OutPkt = HK_FindOutputPkt(SchedEntry->OutputMid);
+            if (OutPkt != NULL)
+            {
+                OutPkt->CompleteTimeout = SchedEntry->CompleteTimeout;
+                OutPkt->StaleThreshold  = SchedEntry->StaleThreshold;
+
+                /* An unchanged packet is found by comparing it with a copy of the data last sent */
+                if ((SchedEntry->Heartbeat != 0) && HK_AllocLastSentData(OutPkt))
+                {
+                    OutPkt->Heartbeat = SchedEntry->Heartbeat;
+
+                    /* The first send request after a change always sends */
+                    OutPkt->SkippedSends = SchedEntry->Heartbeat;
+                }
+
+                if (SchedEntry->IncompletePolicy != HK_INCOMPLETE_POLICY_DEFAULT)
+                {
+                    OutPkt->DiscardIncomplete = (SchedEntry->IncompletePolicy == HK_INCOMPLETE_POLICY_DISCARD);
+                }
+            }
+        }
+    }
 }
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                     */
-/* Check the status of HK Copy table and perform any necessary action. */
-/*                                                                     */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HK_CheckStatusOfCopyTable(void)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK check whether a combined output message is complete          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_IsOutputPktComplete(const HK_OutputPktEntry_t *OutPkt)
 {
-    int32 Status;
-    int32 HKStatus = HK_ERROR; /* Assume failure */
-
-    /* Determine if the copy table has a validation or update that needs to be performed */
-    Status = CFE_TBL_GetStatus(HK_AppData.CopyTableHandle);
+    uint32 FirstBit = OutPkt->FirstEntry;
+    uint32 EndBit   = OutPkt->FirstEntry + OutPkt->NumEntries;
+    uint32 WordIdx;
+    uint32 ExpectedBits;
 
-    if (Status == CFE_TBL_INFO_VALIDATION_PENDING)
+    /* The packet is complete when its received bits match its expected bits */
+    for (WordIdx = FirstBit / HK_DATA_PRESENT_WORD_BITS; (WordIdx * HK_DATA_PRESENT_WORD_BITS) < EndBit; WordIdx++)
     {
-        /* Validate the specified Table */
-        Status = CFE_TBL_Validate(HK_AppData.CopyTableHandle);
+        ExpectedBits = HK_GetDataPresentMask(WordIdx, FirstBit, EndBit);
 
-        if (Status != CFE_SUCCESS)
+        if ((HK_AppData.DataPresentBits[WordIdx] & ExpectedBits) != ExpectedBits)
         {
-            CFE_EVS_SendEvent(HK_UNEXPECTED_TBLVLD_RET_EID, CFE_EVS_EventType_ERROR,
-                              "Unexpected CFE_TBL_Validate return (0x%08X) for Copy Table", (unsigned int)Status);
+            return false;
         }
-        HKStatus = HK_SUCCESS; /* This could just be a bad table, so no reason to abort the app */
     }
-    else if (Status == CFE_TBL_INFO_UPDATE_PENDING)
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK send the output messages an input message completed          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_SendCompletedPackets(const HK_InputIndexEntry_t *IndexEntry)
+{
+    const HK_CopyOp_t *  CopyOp;
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               OpLoop;
+    uint16               LastPkt = HK_AppData.NumOutputPkts;
+
+    for (OpLoop = 0; OpLoop < IndexEntry->NumOps; OpLoop++)
     {
-        /* Unsubscribe to input msgs and free out pkt buffers */
-        /* If the copy table pointer is bad, that's okay here because it will be re-allocated later.
-           If the runtime table pointer is bad, the process new copy table call later on will
-           flag the error.  So we can ignore the return status at this point.
-        */
-        HK_TearDownOldCopyTable(HK_AppData.CopyTablePtr, HK_AppData.RuntimeTablePtr);
+        CopyOp = &HK_AppData.CopyOps[IndexEntry->FirstOp + OpLoop];
 
-        /* release address must be called for update to take. */
-        Status = CFE_TBL_ReleaseAddress(HK_AppData.CopyTableHandle);
+        /* The operations are in output order, so each packet is usually seen once in a row */
+        if ((CopyOp->OutputPkt == LastPkt) || (CopyOp->OutputPkt >= HK_AppData.NumOutputPkts))
+        {
+            continue;
+        }
 
-        /* Releasing the address should only return CFE_SUCCESS at this point since we
-           already had an update-pending response earlier */
-        if (Status == CFE_SUCCESS)
+        LastPkt = CopyOp->OutputPkt;
+        OutPkt  = &HK_AppData.OutputPkts[LastPkt];
+
+        if ((OutPkt->CompleteTimeout != 0) && HK_IsOutputPktComplete(OutPkt))
         {
-            /* Update the copy table */
-            Status = CFE_TBL_Update(HK_AppData.CopyTableHandle);
+            CFE_ES_PerfLogEntry(HK_SEND_COMBINED_PERF_ID);
+            HK_SendOutputPkt(OutPkt, false);
+            CFE_ES_PerfLogExit(HK_SEND_COMBINED_PERF_ID);
+        }
+    }
+}
 
-            if (Status == CFE_SUCCESS)
-            {
-                /* Get address of the newly updated copy table. */
-                Status = CFE_TBL_GetAddress((void *)(&HK_AppData.CopyTablePtr), HK_AppData.CopyTableHandle);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK send the output messages whose complete timeout expired      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_CheckCompleteTimeouts(void)
+{
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               Loop;
 
-                /* Status should only be CFE_TBL_INFO_UPDATED because we updated it above */
-                if (Status == CFE_TBL_INFO_UPDATED)
-                {
-                    Status = HK_ProcessNewCopyTable(HK_AppData.CopyTablePtr, HK_AppData.RuntimeTablePtr);
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        OutPkt = &HK_AppData.OutputPkts[Loop];
 
-                    if (Status == CFE_SUCCESS)
-                    {
-                        HKStatus = HK_SUCCESS;
-                    }
-                    else
-                    {
-                        /* If status was not success, then the copy table function received a NULL pointer argument */
-                        CFE_EVS_SendEvent(HK_NEWCPYTBL_HK_FAILED_EID, CFE_EVS_EventType_CRITICAL,
-                                          "Process New Copy Table Failed, status = 0x%08X", (unsigned int)Status);
-                    }
-                }
-                else
-                {
-                    CFE_EVS_SendEvent(HK_UNEXPECTED_GETADDR_RET_EID, CFE_EVS_EventType_CRITICAL,
-                                      "Unexpected CFE_TBL_GetAddress return (0x%08X) for Copy Table",
-                                      (unsigned int)Status);
-                }
-            }
-            else
+        if (OutPkt->CompleteTimeout != 0)
+        {
+            OutPkt->WakeupsSinceSend++;
+
+            /* Waited long enough, send what has arrived */
+            if (OutPkt->WakeupsSinceSend >= OutPkt->CompleteTimeout)
             {
-                CFE_EVS_SendEvent(HK_UNEXPECTED_TBLUPD_RET_EID, CFE_EVS_EventType_CRITICAL,
-                                  "Unexpected CFE_TBL_Update return (0x%08X) for Copy Table", (unsigned int)Status);
+                CFE_ES_PerfLogEntry(HK_SEND_COMBINED_PERF_ID);
+                HK_SendOutputPkt(OutPkt, true);
+                CFE_ES_PerfLogExit(HK_SEND_COMBINED_PERF_ID);
             }
         }
-        else
-        {
-            CFE_EVS_SendEvent(HK_UNEXPECTED_RELADDR_RET_EID, CFE_EVS_EventType_CRITICAL,
-                              "Unexpected CFE_TBL_ReleaseAddress return (0x%08X) for Copy Table", (unsigned int)Status);
-        }
     }
-    else if (Status != CFE_SUCCESS)
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK check whether a combined output message is unchanged         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_SkipUnchangedPkt(HK_OutputPktEntry_t *OutPkt)
+{
+    const uint8 *DataPtr;
+    size_t       DataSize;
+
+    if ((OutPkt->Heartbeat == 0) || (OutPkt->LastSentData == NULL))
     {
-        CFE_EVS_SendEvent(HK_UNEXPECTED_GETSTAT_RET_EID, CFE_EVS_EventType_CRITICAL,
-                          "Unexpected CFE_TBL_GetStatus return (0x%08X) for Copy Table", (unsigned int)Status);
+        return false;
     }
-    else
+
+    DataPtr  = (const uint8 *)OutPkt->OutBuffer + HK_OUTPUT_HDR_SIZE;
+    DataSize = OutPkt->PacketSize - HK_OUTPUT_HDR_SIZE;
+
+    if (((OutPkt->SkippedSends + 1) < OutPkt->Heartbeat) && (memcmp(DataPtr, OutPkt->LastSentData, DataSize) == 0))
     {
-        /* Only way to get here is if Status == CFE_SUCCESS */
-        HKStatus = HK_SUCCESS;
+        OutPkt->SkippedSends++;
+        return true;
     }
 
-    return HKStatus;
+    memcpy(OutPkt->LastSentData, DataPtr, DataSize);
+    OutPkt->SkippedSends = 0;
+
+    return false;
 }
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                     */
-/* Check the status of HK Dump table and perform any necessary action. */
-/*                                                                     */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HK_CheckStatusOfDumpTable(void)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK allocate the copy of the data last sent                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HK_AllocLastSentData(HK_OutputPktEntry_t *OutPkt)
 {
-    int32 Status;
-    int32 HKStatus = HK_ERROR; /* Assume failure */
+    size_t       DataSize;
+    CFE_Status_t Result;
 
-    /* Determine if the runtime table has a dump pending */
-    Status = CFE_TBL_GetStatus(HK_AppData.RuntimeTableHandle);
+    if (OutPkt->LastSentData != NULL)
+    {
+        return true;
+    }
 
-    if (Status == CFE_TBL_INFO_DUMP_PENDING)
+    /* A packet without data is never written, so there is nothing to compare */
+    if (OutPkt->PacketSize <= HK_OUTPUT_HDR_SIZE)
     {
-        /* Dump the specified Table, cfe tbl manager makes copy */
-        Status = CFE_TBL_DumpToBuffer(HK_AppData.RuntimeTableHandle);
+        return false;
+    }
 
-        if (Status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(HK_UNEXPECTED_DUMPTOBUFFER_RET_EID, CFE_EVS_EventType_CRITICAL,
-                              "Unexpected CFE_TBL_DumpToBuffer return (0x%08X) for Runtime Table",
-                              (unsigned int)Status);
-        }
-        else
+    DataSize = OutPkt->PacketSize - HK_OUTPUT_HDR_SIZE;
+
+#if HK_OUTPUT_ARENA == 1
+    OutPkt->LastSentData = (uint8 *)HK_AllocArenaPkt(DataSize);
+    Result               = (OutPkt->LastSentData != NULL) ? CFE_SUCCESS : CFE_ES_ERR_MEM_BLOCK_SIZE;
+#else
+    Result = CFE_ES_GetPoolBuf((void **)&OutPkt->LastSentData, HK_AppData.MemPoolHandle, DataSize);
+#endif
+
+    if (Result < CFE_SUCCESS)
+    {
+        OutPkt->LastSentData = NULL;
+
+        CFE_EVS_SendEvent(HK_MEM_POOL_MALLOC_FAILED_EID, CFE_EVS_EventType_ERROR,
+                          "HK Send Schedule: ES_GetPoolBuf for size %d returned 0x%04X, pkt 0x%08lX always sent",
+                          (int)DataSize, (unsigned int)Result, (unsigned long)CFE_SB_MsgIdToValue(OutPkt->OutputMid));
+        return false;
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK release the copies of the data last sent                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_ReleaseLastSentData(void)
+{
+    HK_OutputPktEntry_t *OutPkt;
+    uint16               Loop;
+#if HK_OUTPUT_ARENA == 0
+    CFE_Status_t Result;
+#endif
+
+    for (Loop = 0; Loop < HK_AppData.NumOutputPkts; Loop++)
+    {
+        OutPkt = &HK_AppData.OutputPkts[Loop];
+
+        if (OutPkt->LastSentData != NULL)
         {
-            HKStatus = HK_SUCCESS;
+#if HK_OUTPUT_ARENA == 0
+            Result = CFE_ES_PutPoolBuf(HK_AppData.MemPoolHandle, OutPkt->LastSentData);
+            if (Result < CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(HK_MEM_POOL_FREE_FAILED_EID, CFE_EVS_EventType_ERROR,
+                                  "HK TearDown: ES_putPoolBuf Err pkt:0x%08lX ret 0x%04X, hdl 0x%08lx",
+                                  (unsigned long)OutPkt->LastSentData, (unsigned int)Result,
+                                  CFE_RESOURCEID_TO_ULONG(HK_AppData.MemPoolHandle));
+            }
+#endif
+            OutPkt->LastSentData = NULL;
+            OutPkt->Heartbeat    = 0;
         }
     }
-    else if (Status != CFE_SUCCESS)
+}
+
+#if HK_STALE_DATA_CHECK == 1
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK zero fill the stale data of a combined output message        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 HK_DropStaleData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *StaleInputMid)
+{
+    const HK_CopyTableEntry_t *CpyTblEntry;
+    uint32                     NowSecs;
+    uint16                     BitPos;
+    uint16                     NumStale = 0;
+
+    if (OutPkt->StaleThreshold == 0)
     {
-        CFE_EVS_SendEvent(HK_UNEXPECTED_GETSTAT2_RET_EID, CFE_EVS_EventType_CRITICAL,
-                          "Unexpected CFE_TBL_GetStatus return (0x%08X) for Runtime Table", (unsigned int)Status);
+        return 0;
     }
-    else
+
+    NowSecs = CFE_TIME_GetMET().Seconds;
+
+    /* The data present bit positions of the packet are also its refresh time positions */
+    for (BitPos = OutPkt->FirstEntry; BitPos < (OutPkt->FirstEntry + OutPkt->NumEntries); BitPos++)
     {
-        /* Only way to get here is if Status == CFE_SUCCESS */
-        HKStatus = HK_SUCCESS;
+        if ((NowSecs - HK_AppData.RefreshTime[BitPos]) > OutPkt->StaleThreshold)
+        {
+            CpyTblEntry = &HK_AppData.CopyTablePtr[HK_AppData.OutputEntryList[BitPos]];
+
+            if (NumStale == 0)
+            {
+                *StaleInputMid = CpyTblEntry->InputMid;
+            }
+
+            memset((uint8 *)OutPkt->OutBuffer + CpyTblEntry->OutputOffset, 0, CpyTblEntry->NumBytes);
+            NumStale++;
+        }
     }
 
-    return HKStatus;
+    return NumStale;
 }
+#endif
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK Check for missing combined output message data               */
+/* HK reset the input message statistics                           */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HK_CheckForMissingData(CFE_SB_MsgId_t OutPktToCheck, CFE_SB_MsgId_t *MissingInputMid)
+void HK_ResetInputStats(void)
 {
-    int32                   Loop             = 0;
-    int32                   Status           = HK_NO_MISSING_DATA;
-    HK_CopyTableEntry_t *   StartOfCopyTable = HK_AppData.CopyTablePtr;
-    HK_CopyTableEntry_t *   CpyTblEntry      = NULL;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = HK_AppData.RuntimeTablePtr;
-    HK_RuntimeTableEntry_t *RtTblEntry       = NULL;
+    HK_InputStatsTableEntry_t *StatsPtr = HK_AppData.InputStatsTablePtr;
+    uint16                     Loop;
 
-    /* Loop thru each item in the runtime table until end is reached or
-     * data-not-present detected */
-    do
+    if (StatsPtr == NULL)
     {
-        CpyTblEntry = &StartOfCopyTable[Loop];
-        RtTblEntry  = &StartOfRtTable[Loop];
+        return;
+    }
 
-        /* Empty table entries are defined by NULL's in this field */
-        if (CFE_ES_MEMADDRESS_TO_PTR(RtTblEntry->OutputPktAddr) != NULL &&
-            CFE_SB_MsgId_Equal(CpyTblEntry->OutputMid, OutPktToCheck) && RtTblEntry->DataPresent == HK_DATA_NOT_PRESENT)
+    memset(StatsPtr, 0, sizeof(HK_InputStatsTableEntry_t) * HK_COPY_TABLE_ENTRIES);
+
+    /* The statistics are kept in the same order as the input index */
+    for (Loop = 0; Loop < HK_COPY_TABLE_ENTRIES; Loop++)
+    {
+        if (Loop < HK_AppData.NumInputIndexEntries)
+        {
+            StatsPtr[Loop].InputMid = HK_AppData.InputIndex[Loop].InputMid;
+        }
+        else
         {
-            *MissingInputMid = CpyTblEntry->InputMid;
-            Status           = HK_MISSING_DATA_DETECTED;
+            StatsPtr[Loop].InputMid = CFE_SB_INVALID_MSG_ID;
         }
+    }
+}
 
-        Loop++;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK update the statistics of an input message                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_UpdateInputStats(const HK_InputIndexEntry_t *IndexEntry, bool ShortPkt)
+{
+    HK_InputStatsTableEntry_t *Stats;
+    CFE_TIME_SysTime_t         Now;
+    CFE_TIME_SysTime_t         Interval;
+    uint32                     IntervalMs;
 
-    } while ((Loop < HK_COPY_TABLE_ENTRIES) && (Status == HK_NO_MISSING_DATA));
+    if (HK_AppData.InputStatsTablePtr == NULL)
+    {
+        return;
+    }
 
-    return Status;
+    Stats = &HK_AppData.InputStatsTablePtr[IndexEntry - HK_AppData.InputIndex];
+    Now   = CFE_TIME_GetMET();
+
+    if (Stats->RcvCount != 0)
+    {
+        Interval = CFE_TIME_Subtract(Now, Stats->LastRcvTime);
+
+        /* Convert to milliseconds, saturating at the largest value */
+        if (Interval.Seconds >= (0xFFFFFFFF / 1000))
+        {
+            IntervalMs = 0xFFFFFFFF;
+        }
+        else
+        {
+            IntervalMs = (Interval.Seconds * 1000) + (uint32)(((uint64)Interval.Subseconds * 1000) >> 32);
+        }
+
+        if ((Stats->RcvCount == 1) || (IntervalMs < Stats->MinInterval))
+        {
+            Stats->MinInterval = IntervalMs;
+        }
+        if (IntervalMs > Stats->MaxInterval)
+        {
+            Stats->MaxInterval = IntervalMs;
+        }
+    }
+
+    Stats->LastRcvTime = Now;
+    if (Stats->RcvCount != 0xFFFFFFFF)
+    {
+        Stats->RcvCount++;
+    }
+    if (ShortPkt && (Stats->ShortPktCount != 0xFFFFFFFF))
+    {
+        Stats->ShortPktCount++;
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* HK Set data present flags to 'data-not-present'                 */
+/* HK dump the input statistics table when requested               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HK_SetFlagsToNotPresent(CFE_SB_MsgId_t OutPkt)
+void HK_CheckStatusOfInputStatsTable(void)
 {
-    int32                   Loop             = 0;
-    HK_CopyTableEntry_t *   StartOfCopyTable = HK_AppData.CopyTablePtr;
-    HK_CopyTableEntry_t *   CpyTblEntry      = NULL;
-    HK_RuntimeTableEntry_t *StartOfRtTable   = HK_AppData.RuntimeTablePtr;
-    HK_RuntimeTableEntry_t *RtTblEntry       = NULL;
+    int32 Status;
 
-    /* Look thru each item in the runtime table until end is reached */
-    for (Loop = 0; Loop < HK_COPY_TABLE_ENTRIES; Loop++)
+    Status = CFE_TBL_GetStatus(HK_AppData.InputStatsTableHandle);
+
+    if (Status == CFE_TBL_INFO_DUMP_PENDING)
+    {
+        /* Dump the specified Table, cfe tbl manager makes copy */
+        Status = CFE_TBL_DumpToBuffer(HK_AppData.InputStatsTableHandle);
+    }
+
+    /* A status that persists is only reported when it first appears */
+    if ((Status != CFE_SUCCESS) && (Status != HK_AppData.InputStatsTableStatus))
     {
-        CpyTblEntry = &StartOfCopyTable[Loop];
-        RtTblEntry  = &StartOfRtTable[Loop];
+        CFE_EVS_SendEvent(HK_ISTBL_DUMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unexpected status (0x%08X) dumping Input Statistics Table", (unsigned int)Status);
+    }
 
-        /* Empty table entries are defined by NULL's in this field */
-        if (CFE_ES_MEMADDRESS_TO_PTR(RtTblEntry->OutputPktAddr) != NULL &&
-            CFE_SB_MsgId_Equal(CpyTblEntry->OutputMid, OutPkt))
-        {
-            RtTblEntry->DataPresent = HK_DATA_NOT_PRESENT;
-        }
+    HK_AppData.InputStatsTableStatus = Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK get the time elapsed since a MET time stamp                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HK_GetElapsedSubsecs(CFE_TIME_SysTime_t StartTime)
+{
+    CFE_TIME_SysTime_t ElapsedTime = CFE_TIME_Subtract(CFE_TIME_GetMET(), StartTime);
+
+    /* Anything that took a second or more is reported as the largest value */
+    if (ElapsedTime.Seconds != 0)
+    {
+        return 0xFFFFFFFF;
     }
+
+    return ElapsedTime.Subseconds;
 }
 
 /************************/
@@ -43,6 +43,109 @@
 
 #define HK_NULL_POINTER_DETECTED (-1) /**< \brief An input table pointer was NULL */
 
+#define HK_NO_PREV_ROW (0xFFFF) /**< \brief Copy table row does not keep the data of a previous table row */
+
+#define HK_DATA_PRESENT_WORD_BITS (32) /**< \brief Number of data present bits per bitset word */
+
+/**
+ * \brief Number of words in the data present bitset
+ *
+ *  One bit per copy table entry, see #HK_AppData_t::DataPresentBits.
+ */
+#define HK_DATA_PRESENT_WORDS ((HK_COPY_TABLE_ENTRIES + HK_DATA_PRESENT_WORD_BITS - 1) / HK_DATA_PRESENT_WORD_BITS)
+
+/**
+ * \brief Number of bytes at the start of a combined packet used by the message headers
+ *
+ *  The primary and telemetry secondary headers.  Any spare bytes that pad
+ *  the header structure are free for copy table data.
+ */
+#define HK_OUTPUT_HDR_SIZE (offsetof(CFE_MSG_TelemetryHeader_t, Sec) + sizeof(CFE_MSG_TelemetrySecondaryHeader_t))
+
+/**
+ * \brief Number of memory pool bytes taken by an output packet of the given size
+ *
+ *  Output packets are aligned like any memory pool block, so each one
+ *  takes its size rounded up to that alignment.
+ */
+#define HK_OUTPUT_BLOCK_SIZE(Size) \
+    ((((Size) + sizeof(CFE_ES_PoolAlign_t) - 1) / sizeof(CFE_ES_PoolAlign_t)) * sizeof(CFE_ES_PoolAlign_t))
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \brief Input message dispatch index entry
+ *
+ *  One entry exists for each distinct input MsgId in the active copy table.
+ *  The entries are kept sorted by MsgId value so that an incoming message
+ *  can be located with a binary search instead of a scan of the copy table.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t InputMid;   /**< \brief MsgId of the input packet */
+    uint16         FirstEntry; /**< \brief Position of first row in the input entry list */
+    uint16         NumEntries; /**< \brief Number of copy table rows fed by this input packet */
+    uint16         FirstOp;    /**< \brief Position of first copy operation in the copy program */
+    uint16         NumOps;     /**< \brief Number of copy operations for this input packet */
+    uint32         MinLength;  /**< \brief Smallest packet length that holds every copy operation */
+} HK_InputIndexEntry_t;
+
+/**
+ * \brief Copy program operation
+ *
+ *  One contiguous copy from an input packet into an output packet.  Copy table
+ *  rows that are adjacent in both the input and the output packet are merged
+ *  into a single operation; the rows it covers are listed in the operation
+ *  entry list so that each row's data present flag can still be maintained.
+ */
+typedef struct
+{
+    uint8 *DestPtr;     /**< \brief Destination address in the output packet */
+    uint16 InputOffset; /**< \brief Byte offset of the data in the input packet */
+    uint16 NumBytes;    /**< \brief Number of bytes to copy */
+    uint16 FirstEntry;  /**< \brief Position of first covered row in the operation entry list */
+    uint16 NumEntries;  /**< \brief Number of copy table rows covered by this operation */
+    uint16 OutputPkt;   /**< \brief Index of the descriptor of the destination output packet */
+} HK_CopyOp_t;
+
+/**
+ * \brief Combined output packet descriptor
+ *
+ *  One descriptor exists for each combined output packet built from the active
+ *  copy table.  The descriptors are kept sorted by MsgId value; each one lists
+ *  the copy table rows that contribute to the packet so that a send request
+ *  only visits the rows of the packet being sent.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t   OutputMid;         /**< \brief MsgId of the combined output packet */
+    CFE_SB_Buffer_t *OutBuffer;         /**< \brief Combined output packet buffer */
+    CFE_SB_Buffer_t *SpareBuffer;       /**< \brief Initialized buffer for the next packet, or NULL */
+    bool             SpareQueued;       /**< \brief Packet is listed for a spare buffer refill */
+    size_t           PacketSize;        /**< \brief Size of the combined output packet in bytes */
+    uint16           FirstEntry;        /**< \brief Position of first row in the output entry list */
+    uint16           NumEntries;        /**< \brief Number of copy table rows that feed this packet */
+    uint16           FirstOp;           /**< \brief Position of first operation in the packet operation list */
+    uint16           NumOps;            /**< \brief Number of copy operations that write this packet */
+    uint16           CompleteTimeout;   /**< \brief Wakeups to wait for a complete packet, 0 if not used */
+    uint16           WakeupsSinceSend;  /**< \brief Wakeups since the packet was last sent */
+    uint16           StaleThreshold;    /**< \brief Seconds after which an entry's data is stale, 0 if never stale */
+    bool             DiscardIncomplete; /**< \brief Discard the packet when data is missing */
+    uint16           Heartbeat;         /**< \brief Send requests between sends of an unchanged packet */
+    uint16           SkippedSends;      /**< \brief Send requests skipped since the packet was last sent */
+    uint8 *          LastSentData;      /**< \brief Copy of the data of the packet last sent, or NULL */
+} HK_OutputPktEntry_t;
+
+/**
+ * \brief Copy table row comparison function
+ *
+ *  Returns a negative, zero or positive value when the first entry sorts
+ *  before, equal to or after the second entry.
+ */
+typedef int32 (*HK_CompareFunc_t)(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2);
+
 /************************************************************************
  * Prototypes for functions defined in hk_utils.c
  ************************************************************************/
@@ -51,14 +154,17 @@
  * \brief Process incoming housekeeping data message
  *
  * \par Description
- *        This routine examines each entry in the table and determines whether
- *        its field comprises a legal entry.  If so, a portion of the input
- *        packet is copied to the appropriate combined output packet.
+ *        This routine looks up the input message in the dispatch index and
+ *        runs the copy operations compiled for that message, each of which
+ *        copies a portion of the input packet to the appropriate combined
+ *        output packet.
  *
  * \par Assumptions, External Events, and Notes:
  *        Currently the combined telemetry packets are not initialized after
  *        they are sent so values will repeat if no housekeeping update is
- *        received.
+ *        received.  When #HK_ZERO_COPY_SEND is set each send continues in a
+ *        zero filled buffer instead, so values that are not updated before
+ *        the next send read as zero.
  *
  * \param[in] BufPtr A pointer to the input message.
  *
@@ -66,6 +172,197 @@
  */
 void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Sort a list of copy table rows
+ *
+ * \par Description
+ *        Sorts a list of copy table row indices using the supplied comparison
+ *        function.  This is an iterative merge sort, so the sort is stable (rows
+ *        that compare equal keep their table order) and the worst case cost is
+ *        O(N log N).
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Uses the HK global sort work area, the list may not exceed
+ *        #HK_COPY_TABLE_ENTRIES rows.
+ *
+ * \param[in,out] EntryList   List of copy table row indices to sort
+ * \param[in]     NumEntries  Number of rows in the list
+ * \param[in]     CpyTblPtr   A pointer to the first entry in the copy table
+ * \param[in]     CompareFunc Comparison function that defines the sort order
+ */
+void HK_SortEntryList(uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                      HK_CompareFunc_t CompareFunc);
+
+/**
+ * \brief Find the first row of a sorted list not below a key
+ *
+ * \par Description
+ *        Binary search of a list of copy table row indices that was sorted
+ *        by #HK_SortEntryList with the same comparison function.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] EntryList   Sorted list of copy table row indices
+ * \param[in] NumEntries  Number of rows in the list
+ * \param[in] CpyTblPtr   A pointer to the first entry in the copy table
+ * \param[in] Key         Copy table row to search for
+ * \param[in] CompareFunc Comparison function the list is sorted by
+ *
+ * \return Position of the first row that does not compare below the key,
+ *         NumEntries if there is none
+ */
+uint16 HK_LowerBoundEntryList(const uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                              const HK_CopyTableEntry_t *Key, HK_CompareFunc_t CompareFunc);
+
+/**
+ * \brief Compare two copy table rows by input MsgId
+ *
+ * \par Description
+ *        Comparison function for #HK_SortEntryList that orders rows by the
+ *        value of their input MsgId.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] Entry1 First copy table row
+ * \param[in] Entry2 Second copy table row
+ *
+ * \return Negative, zero or positive per the relative order of the rows
+ */
+int32 HK_CompareInputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2);
+
+/**
+ * \brief Build the input message dispatch index
+ *
+ * \par Description
+ *        Groups the copy table rows that have a valid input MsgId and an
+ *        allocated output packet by input MsgId.  The resulting index is used
+ *        by #HK_ProcessIncomingHkData to find the rows for a message without
+ *        scanning the whole copy table.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Must be called whenever the output packet addresses in the run-time
+ *        table change.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the copy table.
+ * \param[in] RtTblPtr  A pointer to the first entry in the run-time table.
+ *
+ * \sa #HK_FindInputIndex
+ */
+void HK_BuildInputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Compare two copy table rows by output position
+ *
+ * \par Description
+ *        Comparison function for #HK_SortEntryList that orders rows by output
+ *        MsgId and then by offset within the output packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] Entry1 First copy table row
+ * \param[in] Entry2 Second copy table row
+ *
+ * \return Negative, zero or positive per the relative order of the rows
+ */
+int32 HK_CompareOutputPosition(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2);
+
+/**
+ * \brief Compile the copy program
+ *
+ * \par Description
+ *        Translates the rows of each input index entry into a list of copy
+ *        operations.  Rows of the same input message are ordered by output
+ *        position and rows that are adjacent in both the input and the output
+ *        packet are merged into one wider copy.  The packet length needed by
+ *        all operations of an input message is recorded in its index entry,
+ *        and the operations that write each output packet are listed in its
+ *        descriptor.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Must be called after #HK_BuildInputIndex and #HK_BuildOutputIndex.
+ *        The copy table must have passed #HK_ValidateHkCopyTable, which
+ *        rejects rows that write overlapping output bytes.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the copy table.
+ * \param[in] RtTblPtr  A pointer to the first entry in the run-time table.
+ *
+ * \sa #HK_ProcessIncomingHkData
+ */
+void HK_CompileCopyProgram(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Compare two copy table rows by output MsgId
+ *
+ * \par Description
+ *        Comparison function for #HK_SortEntryList that orders rows by the
+ *        value of their output MsgId.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] Entry1 First copy table row
+ * \param[in] Entry2 Second copy table row
+ *
+ * \return Negative, zero or positive per the relative order of the rows
+ */
+int32 HK_CompareOutputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2);
+
+/**
+ * \brief Build the combined output packet descriptors
+ *
+ * \par Description
+ *        Groups the copy table rows that have an allocated output packet by
+ *        output MsgId and records, for each packet, its buffer, its size and
+ *        the rows that feed it.  Each row is assigned the data present bit
+ *        at its position in the grouped list, so the bits of a packet are
+ *        contiguous.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Must be called whenever the output packet addresses in the run-time
+ *        table change.  Clears the data present bitset and, when
+ *        #HK_STALE_DATA_CHECK is set, sets every refresh time to the
+ *        current MET seconds.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the copy table.
+ * \param[in] RtTblPtr  A pointer to the first entry in the run-time table.
+ *
+ * \sa #HK_FindOutputPkt
+ */
+void HK_BuildOutputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Find the descriptor of a combined output packet
+ *
+ * \par Description
+ *        Binary search of the combined output packet descriptors.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] OutputMid MsgId of the combined output packet
+ *
+ * \return Pointer to the descriptor, or NULL if the packet is not in the copy table
+ */
+HK_OutputPktEntry_t *HK_FindOutputPkt(CFE_SB_MsgId_t OutputMid);
+
+/**
+ * \brief Find the dispatch index entry for an input message
+ *
+ * \par Description
+ *        Binary search of the input message dispatch index.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] InputMid MsgId of the input message
+ *
+ * \return Pointer to the index entry, or NULL if no copy table row uses this MsgId
+ */
+const HK_InputIndexEntry_t *HK_FindInputIndex(CFE_SB_MsgId_t InputMid);
+
 /**
  * \brief Validate Housekeeping Copy Table
  *
@@ -86,6 +383,71 @@ void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr);
  */
 int32 HK_ValidateHkCopyTable(void *TblPtr);
 
+/**
+ * \brief Count the populated copy table rows
+ *
+ * \par Description
+ *        Finds the last copy table row with a valid input or output
+ *        MsgId.  The rows past it are unused, so the table processing
+ *        loops can stop there instead of walking the whole table.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Unused rows in the middle of the table are still counted.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the copy table.
+ *
+ * \return Number of rows up to and including the last populated one
+ */
+uint16 HK_CountCopyTableRows(const HK_CopyTableEntry_t *CpyTblPtr);
+
+/**
+ * \brief Find overlapping output rows
+ *
+ * \par Description
+ *        Sorts the copy table rows that copy data by output MsgId and
+ *        offset, then walks each output packet once to find a row that
+ *        writes bytes already written by another row of the same packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Rows that copy no bytes never overlap.
+ *
+ * \param[in]  CpyTblPtr  A pointer to the first entry in the copy table.
+ * \param[in]  NumTblRows Number of rows to check, from the first one.
+ * \param[out] EntryIdx   Row that overlaps an earlier part of its packet.
+ * \param[out] OtherIdx   Row whose bytes it overlaps.
+ *
+ * \return true if an overlap was found, false otherwise
+ *
+ * \sa #HK_ValidateHkCopyTable
+ */
+bool HK_FindOutputOverlap(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx, uint16 *OtherIdx);
+
+/**
+ * \brief Find the output packet that does not fit in the memory pool
+ *
+ * \par Description
+ *        Sorts the copy table rows by output MsgId and adds up the pool
+ *        bytes taken by each output packet, in MsgId order, as
+ *        #HK_ProcessNewCopyTable would allocate them.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Every row with a valid output MsgId has a valid input MsgId.
+ *          Only exact for #HK_OUTPUT_ARENA, where the packets are carved
+ *          from the pool memory without block headers, so it is only used
+ *          then.
+ *
+ * \param[in]  CpyTblPtr  A pointer to the first entry in the copy table.
+ * \param[in]  NumTblRows Number of rows to check, from the first one.
+ * \param[out] EntryIdx   First row of the first packet past the end of the pool.
+ * \param[out] PoolBytes  Pool bytes taken by all of the output packets.
+ *
+ * \return true if the packets do not fit in the pool, false otherwise
+ *
+ * \sa #HK_ValidateHkCopyTable
+ */
+bool HK_FindOutputPoolOverflow(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx,
+                               uint32 *PoolBytes);
+
 /**
  * \brief Process New Copy Table
  *
@@ -105,6 +467,28 @@ int32 HK_ValidateHkCopyTable(void *TblPtr);
  */
 CFE_Status_t HK_ProcessNewCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
 
+/**
+ * \brief Check the copy table against the generated copy routine
+ *
+ * \par Description
+ *        Compares the processed copy table, row by row, with the table the
+ *        generated copy routine was built from, and checks that every row
+ *        the routine copies to has an output packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called at the end of #HK_ProcessNewCopyTable, once the output
+ *          packets are allocated.
+ *
+ * \param[in] CpyTblPtr  A pointer to the first entry in the copy table.
+ * \param[in] RtTblPtr   A pointer to the first entry in the run-time table.
+ * \param[in] GenTblPtr  The rows the generated routine was built from.
+ * \param[in] GenNumRows Number of rows in GenTblPtr.
+ *
+ * \return true if the generated routine can be used, false otherwise
+ */
+bool HK_MatchGenCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr,
+                          const HK_CopyTableEntry_t *GenTblPtr, uint16 GenNumRows);
+
 /**
  * \brief Tear Down Old Copy Table
  *
@@ -125,20 +509,296 @@ CFE_Status_t HK_ProcessNewCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTa
 CFE_Status_t HK_TearDownOldCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
 
 /**
- * \brief Send combined output message
+ * \brief Free the packets and subscriptions of copy table rows
  *
  * \par Description
- *        This routine searches for the combined HK that contains the specified
- *        MID.  Once found, the packet is sent.  If not found, an event is
- *        generated. Also sets the data pieces for this output pkt
+ *        Frees each output packet referenced by the run-time rows once,
+ *        unsubscribes from each subscribed input MsgId once, and clears
+ *        those run-time fields.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Uses the input and output entry lists as work areas, so the
+ *          input index and the output packet descriptors must be rebuilt
+ *          before they are used again.
+ *
+ * \param[in]     CpyTblPtr  A pointer to the first entry in the copy table.
+ * \param[in,out] RtTblPtr   A pointer to the first entry in the run-time table.
+ * \param[in]     NumTblRows Number of rows to release.
+ */
+void HK_ReleaseCopyTableRows(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr, uint16 NumTblRows);
+
+/**
+ * \brief Save the copy table that is about to be replaced
+ *
+ * \par Description
+ *        Copies the populated rows of the copy and run-time tables, with
+ *        the data present flag and refresh time of each row, and hands the
+ *        output packets and subscriptions over to the copy.  The next
+ *        #HK_ProcessNewCopyTable takes over what the new table still uses
+ *        and frees the rest.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          When the previous update did not reach #HK_ProcessNewCopyTable
+ *          the saved rows are kept as they are.
+ *
+ * \param[in]     CpyTblPtr A pointer to the first entry in the copy table.
+ * \param[in,out] RtTblPtr  A pointer to the first entry in the run-time table.
+ *
+ * \return Execution Status
+ * \retval #CFE_SUCCESS              \copydoc CFE_SUCCESS
+ * \retval #HK_NULL_POINTER_DETECTED \copydoc HK_NULL_POINTER_DETECTED
+ *
+ * \sa #HK_INCREMENTAL_TABLE_UPDATE
+ */
+CFE_Status_t HK_SavePrevCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Allocate an output packet
+ *
+ * \par Description
+ *        Allocates the buffer of a combined output packet from wherever the
+ *        configuration keeps them: an SB buffer with #HK_ZERO_COPY_SEND,
+ *        the pool memory with #HK_OUTPUT_ARENA, or the HK memory pool.
  *
  * \par Assumptions, External Events, and Notes:
  *          None
  *
+ * \param[out] BufPtr Set to the packet buffer, NULL if it was not allocated.
+ * \param[in]  Size   Size of the output packet, in bytes.
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t HK_AllocOutputPkt(CFE_SB_Buffer_t **BufPtr, size_t Size);
+
+/**
+ * \brief Carve an output packet from the memory pool buffer
+ *
+ * \par Description
+ *        Hands out the next aligned block of the memory pool buffer.
+ *        The blocks are only given back all at once, by setting
+ *        #HK_AppData_t::ArenaUsed back to zero.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Only used when #HK_OUTPUT_ARENA is set.
+ *
+ * \param[in] Size Size of the output packet, in bytes.
+ *
+ * \return The packet buffer, NULL if the rest of the pool is too small
+ */
+CFE_SB_Buffer_t *HK_AllocArenaPkt(size_t Size);
+
+/**
+ * \brief Take over an unchanged output packet of the previous table
+ *
+ * \par Description
+ *        Looks up the saved rows of the output MsgId of a group of new
+ *        rows.  If they are the same rows in the same order, their packet
+ *        buffer is kept and each new row records the saved row whose data
+ *        it keeps.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The group holds every row of one output MsgId, in table order.
+ *          The saved rows keep the buffer address until #HK_CarryPrevData.
+ *
+ * \param[in] CpyTblPtr  A pointer to the first entry in the new copy table.
+ * \param[in] EntryList  Rows of the new table with the same output MsgId.
+ * \param[in] NumEntries Number of rows in the group.
+ *
+ * \return The packet buffer to keep, NULL if the packet changed
+ */
+CFE_SB_Buffer_t *HK_ReusePrevOutputPkt(const HK_CopyTableEntry_t *CpyTblPtr, const uint16 *EntryList,
+                                       uint16 NumEntries);
+
+/**
+ * \brief Free the previous packets that the new table does not keep
+ *
+ * \par Description
+ *        Frees the packets of the saved rows, except the ones already
+ *        taken over by #HK_ReusePrevOutputPkt, to make room for a new
+ *        packet that could not be allocated.  The data of the freed packets
+ *        is not carried into the new table and later groups of new rows
+ *        can no longer keep them.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Only used when #HK_INCREMENTAL_TABLE_UPDATE is set, while
+ *          #HK_ProcessNewCopyTable allocates the new packets.
+ *
+ * \return true if any packet was freed, false otherwise
+ */
+bool HK_FreePrevOutputPkts(void);
+
+/**
+ * \brief Keep a subscription of the previous table
+ *
+ * \par Description
+ *        Takes the subscription to the input MsgId of a new row from the
+ *        saved rows, if they had one.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] CpyTblEntry A row of the new copy table.
+ *
+ * \return true if the input MsgId is still subscribed, false otherwise
+ */
+bool HK_KeepPrevSubscription(const HK_CopyTableEntry_t *CpyTblEntry);
+
+/**
+ * \brief Carry the data of the previous table into changed packets
+ *
+ * \par Description
+ *        Copies, for each new row of a changed packet, the data of a saved
+ *        row with the same input MsgId, input offset and size that had
+ *        data present, and records that saved row.  The packets taken over
+ *        by #HK_ReusePrevOutputPkt are then removed from the saved rows so
+ *        that they are not freed with them.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called once the new packets are allocated and before the saved
+ *          rows are released.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the new copy table.
+ * \param[in] RtTblPtr  A pointer to the first entry in the new run-time table.
+ */
+void HK_CarryPrevData(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Restore the data present flags of kept rows
+ *
+ * \par Description
+ *        Sets the data present bit and refresh time of each row that kept
+ *        the data of a saved row which had data present.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called after #HK_BuildOutputIndex has assigned the new bit positions.
+ */
+void HK_RestoreCarriedData(void);
+
+/**
+ * \brief Send combined output message
+ *
+ * \par Description
+ *        This routine looks up the descriptor of the combined HK packet with
+ *        the specified MID.  Once found, the packet is sent.  If not found, an
+ *        event is generated. Also sets the data pieces for this output pkt
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          When #HK_ZERO_COPY_SEND is set the packet continues in a zero
+ *          filled buffer after the send, see #HK_TransmitOutputPktBuffer.
+ *
  * \param[in]  WhichMidToSend - the MsgId of the combined output message to send
  */
 void HK_SendCombinedHkPacket(CFE_SB_MsgId_t WhichMidToSend);
 
+/**
+ * \brief Send the selected combined output messages
+ *
+ * \par Description
+ *        Sends the combined output messages named by a list of output
+ *        MsgIds.  An empty list sends every combined output message in one
+ *        pass over the output packet descriptors.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        A MsgId that is not an output message of the current copy table
+ *        is reported with the #HK_UNKNOWN_COMBINED_PACKET_EID event and
+ *        skipped.
+ *
+ * \param[in]  MsgIds    - the output MsgIds of the messages to send
+ * \param[in]  NumMsgIds - number of MsgIds in the list, 0 sends all
+ *
+ * \return Number of combined output messages sent
+ *
+ * \sa #HK_SEND_ALL_COMBINED_PKTS_CC
+ */
+uint16 HK_SendAllCombinedPackets(const CFE_SB_MsgId_t *MsgIds, uint16 NumMsgIds);
+
+/**
+ * \brief Send one combined output message
+ *
+ * \par Description
+ *        Checks the output message for missing data, sends it and marks
+ *        its data as not present.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        An output message that discards incomplete data, by default when
+ *        #HK_DISCARD_INCOMPLETE_COMBO is set, is only sent with missing
+ *        data if SendIncomplete is true.
+ *
+ * \param[in]  OutPkt         - descriptor of the combined output message to send
+ * \param[in]  SendIncomplete - send the message even if data is missing
+ *
+ * \return Whether the message was sent
+ * \retval true  The message was handed to SB
+ * \retval false The message was held back, skipped or not accepted by SB
+ */
+bool HK_SendOutputPkt(HK_OutputPktEntry_t *OutPkt, bool SendIncomplete);
+
+/**
+ * \brief Hand a combined output packet buffer off to SB
+ *
+ * \par Description
+ *        Sends the packet without a copy by transmitting its buffer, and
+ *        continues building the packet in a newly allocated, initialized
+ *        SB buffer.  The run-time table rows and copy operations of the
+ *        packet, found through its descriptor, are pointed at the new
+ *        buffer. A spare buffer made by #HK_RefillSpareBuffers is used
+ *        before allocating one.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_ZERO_COPY_SEND is set. If no new buffer can be
+ *        allocated the packet is sent by copy and its buffer is kept.  The
+ *        data sent is copied into the new buffer only for a packet that can
+ *        be sent with missing data, so that it keeps the last values as a
+ *        copy send would.  Other packets continue in a zero filled buffer.
+ *
+ * \param[in]  OutPkt - the descriptor of the combined output packet to send
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t HK_TransmitOutputPktBuffer(HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief List a combined output packet for a spare buffer refill
+ *
+ * \par Description
+ *        Adds the packet to the list walked by #HK_RefillSpareBuffers,
+ *        unless it is already listed.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_DOUBLE_BUFFER_OUTPUT is set.
+ *
+ * \param[in]  OutPkt - the descriptor of the combined output packet
+ */
+void HK_QueueSpareRefill(HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief Replace the used spare output packet buffers
+ *
+ * \par Description
+ *        Allocates and initializes a spare SB buffer for each combined
+ *        output packet listed by #HK_QueueSpareRefill that does not have
+ *        one, and empties the list.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_DOUBLE_BUFFER_OUTPUT is set. A packet whose
+ *        spare cannot be allocated allocates its next buffer when sent,
+ *        and is listed again then.
+ */
+void HK_RefillSpareBuffers(void);
+
+/**
+ * \brief Release the spare output packet buffers
+ *
+ * \par Description
+ *        Releases the spare SB buffer of every combined output packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_DOUBLE_BUFFER_OUTPUT is set.
+ */
+void HK_ReleaseSpareBuffers(void);
+
 /**
  * \brief HK_CheckStatusOfTables
  *
@@ -192,22 +852,24 @@ int32 HK_CheckStatusOfDumpTable(void);
  * \brief Check for Missing Data
  *
  * \par Description
- *        This routine checks for missing data for the given output message.
- *        It returns #HK_MISSING_DATA_DETECTED at the first piece of data that
- *        is not present. The missing Input MsgId is sent back to the caller
- *        through the given pointer named MissingInputMid.
+ *        This routine checks for missing data for the given output message
+ *        by comparing its range of the data present bitset, one word at a
+ *        time, against the expected all-present value.  If any piece of data
+ *        is not present, the Input MsgId of the first missing piece and the
+ *        number of missing pieces are sent back to the caller.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *        Only the copy table rows that feed the given packet are checked.
  *
- * \param[in] OutPktToCheck   MsgId of the combined output message to check
- * \param[in] MissingInputMid A pointer to the caller provided MsgId variable
+ * \param[in]  OutPkt          Descriptor of the combined output message to check
+ * \param[out] MissingInputMid A pointer to the caller provided MsgId variable
+ * \param[out] NumMissing      A pointer to the caller provided count of missing pieces
  *
  * \return Missing Data Status
  * \retval #HK_MISSING_DATA_DETECTED \copydoc HK_MISSING_DATA_DETECTED
  * \retval #HK_NO_MISSING_DATA       \copydoc HK_NO_MISSING_DATA
  */
-int32 HK_CheckForMissingData(CFE_SB_MsgId_t OutPktToCheck, CFE_SB_MsgId_t *MissingInputMid);
+int32 HK_CheckForMissingData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *MissingInputMid, uint16 *NumMissing);
 
 /**
  * \brief Set Data Present Flags to 'Not Present'
@@ -217,10 +879,291 @@ int32 HK_CheckForMissingData(CFE_SB_MsgId_t OutPktToCheck, CFE_SB_MsgId_t *Missi
  *        given combined output message
  *
  * \par Assumptions, External Events, and Notes:
+ *        Clears the packet's range of the data present bitset a word at a
+ *        time.
+ *
+ * \param[in] OutPkt Descriptor of the packet whose data present flags will be set.
+ */
+void HK_SetFlagsToNotPresent(const HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief Get the data present bitset mask of a word
+ *
+ * \par Description
+ *        Returns the bits of the given data present bitset word that fall in
+ *        the range [FirstBit, EndBit).
+ *
+ * \par Assumptions, External Events, and Notes:
  *          None
  *
- * \param[in] OutPkt The MsgId whose data present flags will be set.
+ * \param[in] WordIdx  Index of the bitset word
+ * \param[in] FirstBit First bit of the range
+ * \param[in] EndBit   One past the last bit of the range
+ *
+ * \return Mask of the range bits within the word
+ */
+uint32 HK_GetDataPresentMask(uint32 WordIdx, uint32 FirstBit, uint32 EndBit);
+
+/**
+ * \brief Copy the data present bitset into the run-time table
+ *
+ * \par Description
+ *        Sets the data present flag of every copy table entry that feeds an
+ *        output packet from the data present bitset, so that a dump of the
+ *        run-time table shows exactly which entries are missing.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Entries that do not feed an output packet are never marked present
+ *        and are not visited.
+ *
+ * \param[in] RtTblPtr A pointer to the first entry in the run-time table.
+ *
+ * \sa #HK_CheckStatusOfDumpTable
+ */
+void HK_SyncDataPresentFlags(HK_RuntimeTableEntry_t *RtTblPtr);
+
+/**
+ * \brief Send the combined output messages that are due
+ *
+ * \par Description
+ *        Counts the wakeup and sends every combined output message whose
+ *        send schedule table entry is due on it.  An entry is due when
+ *        the wakeup count modulo its period equals its phase.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Nothing is sent if there is no send schedule table.  Entries for
+ *        messages the current copy table does not build are skipped.
+ *
+ * \sa #HK_WakeupCmd
+ */
+void HK_SendScheduledPackets(void);
+
+/**
+ * \brief Validate Housekeeping Send Schedule Table
+ *
+ * \par Description
+ *      This routine is called from CFE_TBL_Register.  It determines whether
+ *      the data contained in the new table is acceptable.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TblPtr A pointer to the new table data.
+ *
+ * \return Table Validation Status
+ * \retval #HK_SUCCESS Valid table
+ * \retval #HK_ERROR   \copydoc HK_ERROR
+ *
+ * \sa #HK_TableInit
+ */
+int32 HK_ValidateSendSchedTable(void *TblPtr);
+
+/**
+ * \brief Check the status of the send schedule table
+ *
+ * \par Description
+ *        Lets cFE Table Services validate, update or dump the send schedule
+ *        table when one of these is pending, or when the table address was
+ *        lost, and refreshes the table address.  The packet settings are only
+ *        applied again when the table was updated or its address was lost or
+ *        obtained again, so the complete timeouts keep running otherwise.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_SCHEDULED_OUTPUT is set.  A failure is reported
+ *        when the table address is lost, not on every check after that,
+ *        and is not fatal; no packets are sent on schedule until the table
+ *        address can be obtained again.
+ */
+void HK_CheckStatusOfSendSchedTable(void);
+
+/**
+ * \brief Copy the send schedule settings into the output packet descriptors
+ *
+ * \par Description
+ *        Sets the complete timeout, stale threshold, incomplete packet
+ *        policy and heartbeat of each combined output message from its send
+ *        schedule table entry, or to the defaults if it has none, and
+ *        restarts the timeouts.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Called when the copy table or the send schedule table changes.
+ */
+void HK_ApplySendSchedTable(void);
+
+/**
+ * \brief Check whether a combined output message is complete
+ *
+ * \par Description
+ *        Compares the data present bits of the output message with the
+ *        bits expected for it, a word at a time.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ * \param[in]  OutPkt - descriptor of the combined output message
+ *
+ * \return true if every section of the message has arrived
+ */
+bool HK_IsOutputPktComplete(const HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief Send the combined output messages an input message completed
+ *
+ * \par Description
+ *        Visits the output messages fed by an input message and sends each
+ *        one with a complete timeout that now has all of its data.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_SEND_WHEN_COMPLETE is set.
+ *
+ * \param[in]  IndexEntry - dispatch index entry of the input message
+ */
+void HK_SendCompletedPackets(const HK_InputIndexEntry_t *IndexEntry);
+
+/**
+ * \brief Send the combined output messages whose complete timeout expired
+ *
+ * \par Description
+ *        Counts the wakeup for each output message with a complete timeout
+ *        and sends the ones that have waited that many wakeups since they
+ *        were last sent, even if data is missing.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_SEND_WHEN_COMPLETE is set.
+ */
+void HK_CheckCompleteTimeouts(void);
+
+/**
+ * \brief Check whether a combined output message is unchanged
+ *
+ * \par Description
+ *        Compares the data of an output message that has a heartbeat with
+ *        the copy of the data last sent.  An unchanged message is skipped
+ *        until heartbeat send requests have gone by since it was last sent.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        The telemetry header is not compared, so the time stamp does not
+ *        count as a change.  A message that is not skipped is assumed to
+ *        be sent, and its data is copied.  Messages without a heartbeat are
+ *        never skipped and are not compared.
+ *
+ * \param[in]  OutPkt - descriptor of the combined output message
+ *
+ * \return true if the message should not be sent
+ */
+bool HK_SkipUnchangedPkt(HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief Allocate the copy of the data last sent
+ *
+ * \par Description
+ *        Allocates the buffer that #HK_SkipUnchangedPkt keeps the data of
+ *        the message last sent in, unless the message already has one.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        The buffer is carved from the arena when #HK_OUTPUT_ARENA is set,
+ *        otherwise taken from the HK memory pool.  It is kept until the
+ *        copy table is torn down.
+ *
+ * \param[in]  OutPkt - descriptor of the combined output message
+ *
+ * \return true if the message has a buffer for the data last sent
+ */
+bool HK_AllocLastSentData(HK_OutputPktEntry_t *OutPkt);
+
+/**
+ * \brief Release the copies of the data last sent
+ *
+ * \par Description
+ *        Gives back the buffer of every combined output message that keeps
+ *        the data it last sent.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        With #HK_OUTPUT_ARENA set the buffers are only forgotten, the
+ *        arena is given back as a whole with the output packets.
+ */
+void HK_ReleaseLastSentData(void);
+
+/**
+ * \brief Zero fill the stale data of a combined output message
+ *
+ * \par Description
+ *        Zero fills, in the output message, the data of each copy table
+ *        entry that has not been refreshed for more than the stale threshold
+ *        of the message, in MET seconds.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_STALE_DATA_CHECK is set.  Entries that have
+ *        not received data since the copy table was loaded count as last
+ *        refreshed when the table was processed.  Ages are unsigned
+ *        differences, so they stay right when the MET seconds wrap.
+ *        Nothing is dropped if the message has no stale threshold.
+ *
+ * \param[in]  OutPkt        - descriptor of the combined output message
+ * \param[out] StaleInputMid - MsgId of the input message of the first stale entry,
+ *                             only set when an entry is stale
+ *
+ * \return Number of stale entries dropped
+ */
+uint16 HK_DropStaleData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *StaleInputMid);
+
+/**
+ * \brief Reset the input message statistics
+ *
+ * \par Description
+ *        Clears the input statistics table and fills in the input MsgId of
+ *        each entry, in the order of the input dispatch index.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Called after the input dispatch index is rebuilt and on a Reset
+ *        Counters command.  Does nothing if there is no statistics table.
+ */
+void HK_ResetInputStats(void);
+
+/**
+ * \brief Update the statistics of an input message
+ *
+ * \par Description
+ *        Counts the input message and records its receive time and the
+ *        time since the previous one, in milliseconds.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_INPUT_STATS is set.  The statistics entry is
+ *        found from the position of the dispatch index entry, so the update
+ *        takes constant time.
+ *
+ * \param[in]  IndexEntry - dispatch index entry of the input message
+ * \param[in]  ShortPkt   - true if the message was too short for one of its copy table entries
+ */
+void HK_UpdateInputStats(const HK_InputIndexEntry_t *IndexEntry, bool ShortPkt);
+
+/**
+ * \brief Check the status of the input statistics table
+ *
+ * \par Description
+ *        Copies the input statistics table into the dump buffer when a
+ *        dump has been requested.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Only used when #HK_INPUT_STATS is set.  A failure is reported
+ *        when its status differs from the previous check, and is not fatal.
+ */
+void HK_CheckStatusOfInputStatsTable(void);
+
+/**
+ * \brief Get the time elapsed since a MET time stamp
+ *
+ * \par Description
+ *        Returns the MET time elapsed since the given time stamp, in
+ *        subseconds, for the timing statistics.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Intervals of one second or more saturate at 0xFFFFFFFF.
+ *
+ * \param[in] StartTime MET at the start of the interval
+ *
+ * \return Elapsed time in subseconds (2^-32 seconds)
  */
-void HK_SetFlagsToNotPresent(CFE_SB_MsgId_t OutPkt);
+uint32 HK_GetElapsedSubsecs(CFE_TIME_SysTime_t StartTime);
 
 #endif
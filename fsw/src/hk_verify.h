@@ -32,6 +32,80 @@
 #error HK_DISCARD_INCOMPLETE_COMBO cannot be greater than 1!
 #endif
 
+#if HK_ZERO_COPY_SEND < 0
+#error HK_ZERO_COPY_SEND cannot be less than 0!
+#elif HK_ZERO_COPY_SEND > 1
+#error HK_ZERO_COPY_SEND cannot be greater than 1!
+#endif
+
+#if HK_DOUBLE_BUFFER_OUTPUT < 0
+#error HK_DOUBLE_BUFFER_OUTPUT cannot be less than 0!
+#elif HK_DOUBLE_BUFFER_OUTPUT > 1
+#error HK_DOUBLE_BUFFER_OUTPUT cannot be greater than 1!
+#elif (HK_DOUBLE_BUFFER_OUTPUT == 1) && (HK_ZERO_COPY_SEND != 1)
+#error HK_DOUBLE_BUFFER_OUTPUT requires HK_ZERO_COPY_SEND!
+#endif
+
+#if HK_SCHEDULED_OUTPUT < 0
+#error HK_SCHEDULED_OUTPUT cannot be less than 0!
+#elif HK_SCHEDULED_OUTPUT > 1
+#error HK_SCHEDULED_OUTPUT cannot be greater than 1!
+#endif
+
+#if HK_SEND_WHEN_COMPLETE < 0
+#error HK_SEND_WHEN_COMPLETE cannot be less than 0!
+#elif HK_SEND_WHEN_COMPLETE > 1
+#error HK_SEND_WHEN_COMPLETE cannot be greater than 1!
+#elif (HK_SEND_WHEN_COMPLETE == 1) && (HK_SCHEDULED_OUTPUT != 1)
+#error HK_SEND_WHEN_COMPLETE requires HK_SCHEDULED_OUTPUT!
+#endif
+
+#if HK_INPUT_STATS < 0
+#error HK_INPUT_STATS cannot be less than 0!
+#elif HK_INPUT_STATS > 1
+#error HK_INPUT_STATS cannot be greater than 1!
+#endif
+
+#if HK_STALE_DATA_CHECK < 0
+#error HK_STALE_DATA_CHECK cannot be less than 0!
+#elif HK_STALE_DATA_CHECK > 1
+#error HK_STALE_DATA_CHECK cannot be greater than 1!
+#elif (HK_STALE_DATA_CHECK == 1) && (HK_SCHEDULED_OUTPUT != 1)
+#error HK_STALE_DATA_CHECK requires HK_SCHEDULED_OUTPUT!
+#endif
+
+#if HK_INCREMENTAL_TABLE_UPDATE < 0
+#error HK_INCREMENTAL_TABLE_UPDATE cannot be less than 0!
+#elif HK_INCREMENTAL_TABLE_UPDATE > 1
+#error HK_INCREMENTAL_TABLE_UPDATE cannot be greater than 1!
+#endif
+
+#if HK_GENERATED_COPY < 0
+#error HK_GENERATED_COPY cannot be less than 0!
+#elif HK_GENERATED_COPY > 1
+#error HK_GENERATED_COPY cannot be greater than 1!
+#elif (HK_GENERATED_COPY == 1) && !defined(HK_GENERATED_COPY_BUILD)
+#error HK_GENERATED_COPY requires the HK_GENERATED_COPY CMake option!
+#elif (HK_GENERATED_COPY == 0) && defined(HK_GENERATED_COPY_BUILD)
+#error The HK_GENERATED_COPY CMake option requires HK_GENERATED_COPY!
+#endif
+
+#if HK_OUTPUT_ARENA < 0
+#error HK_OUTPUT_ARENA cannot be less than 0!
+#elif HK_OUTPUT_ARENA > 1
+#error HK_OUTPUT_ARENA cannot be greater than 1!
+#elif (HK_OUTPUT_ARENA == 1) && (HK_ZERO_COPY_SEND == 1)
+#error HK_OUTPUT_ARENA cannot be used with HK_ZERO_COPY_SEND!
+#elif (HK_OUTPUT_ARENA == 1) && (HK_INCREMENTAL_TABLE_UPDATE == 1)
+#error HK_OUTPUT_ARENA cannot be used with HK_INCREMENTAL_TABLE_UPDATE!
+#endif
+
+#if HK_TIMING_STATS < 0
+#error HK_TIMING_STATS cannot be less than 0!
+#elif HK_TIMING_STATS > 1
+#error HK_TIMING_STATS cannot be greater than 1!
+#endif
+
 #ifndef HK_PIPE_DEPTH
 #error HK_PIPE_DEPTH must be defined!
 #elif (HK_PIPE_DEPTH < 1)
@@ -46,6 +120,14 @@
  * show up as an obvious run-time error so the compile-time check is redundant.
  */
 
+#ifndef HK_RECV_BATCH_LIMIT
+#error HK_RECV_BATCH_LIMIT must be defined!
+#elif (HK_RECV_BATCH_LIMIT < 1)
+#error HK_RECV_BATCH_LIMIT cannot be less than 1!
+#elif (HK_RECV_BATCH_LIMIT > 65535)
+#error HK_RECV_BATCH_LIMIT cannot be greater than 65535!
+#endif
+
 #ifndef HK_COPY_TABLE_ENTRIES
 #error HK_COPY_TABLE_ENTRIES must be defined!
 #elif (HK_COPY_TABLE_ENTRIES < 1)
@@ -54,6 +136,18 @@
 #error HK_COPY_TABLE_ENTRIES cannot be greater than 8192!
 #endif
 
+#ifndef HK_SEND_SCHED_TABLE_ENTRIES
+#error HK_SEND_SCHED_TABLE_ENTRIES must be defined!
+#elif (HK_SEND_SCHED_TABLE_ENTRIES < 1)
+#error HK_SEND_SCHED_TABLE_ENTRIES cannot be less than 1!
+#endif
+
+#ifndef HK_SEND_ALL_MAX_PKTS
+#error HK_SEND_ALL_MAX_PKTS must be defined!
+#elif (HK_SEND_ALL_MAX_PKTS < 1)
+#error HK_SEND_ALL_MAX_PKTS cannot be less than 1!
+#endif
+
 #ifndef HK_NUM_BYTES_IN_MEM_POOL
 #error HK_NUM_BYTES_IN_MEM_POOL must be defined!
 #endif
@@ -0,0 +1,56 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The CFS Housekeeping (HK) Application Send Schedule Table Definition
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "cfe.h"
+#include "hk_mission_cfg.h"
+#include "hk_msgids.h"
+#include "hk_tbl.h"
+#include "cfe_tbl_filedef.h"
+#include "cfe_sb_extern_typedefs.h"
+
+/*
+** Unlisted entries are zero filled; an entry with a zero period, a zero
+** complete timeout, a zero stale threshold, the default incomplete packet
+** policy and a zero heartbeat is unused
+*/
+HK_SendSchedTable_Array_t HK_SendSchedTable = {
+    /*         outputMid                                   period  phase  completeTimeout  staleThreshold */
+    /*         incompletePolicy  heartbeat */
+
+    /*   0 */ {CFE_SB_MSGID_WRAP_VALUE(HK_COMBINED_PKT1_MID), 1, 0, 0, 0, HK_INCOMPLETE_POLICY_DEFAULT, 0},
+    /*   1 */ {CFE_SB_MSGID_WRAP_VALUE(HK_COMBINED_PKT2_MID), 2, 0, 0, 0, HK_INCOMPLETE_POLICY_DEFAULT, 0},
+    /*   2 */ {CFE_SB_MSGID_WRAP_VALUE(HK_COMBINED_PKT3_MID), 2, 1, 0, 0, HK_INCOMPLETE_POLICY_DEFAULT, 0},
+    /*   3 */ {CFE_SB_MSGID_WRAP_VALUE(HK_COMBINED_PKT4_MID), 4, 3, 0, 0, HK_INCOMPLETE_POLICY_DEFAULT, 0},
+};
+
+/*
+** Table file header
+*/
+CFE_TBL_FILEDEF(HK_SendSchedTable, HK.SendSchedTable, HK Send Schedule Tbl, hk_sched_tbl.tbl)
+
+/************************/
+/*  End of File Comment */
+/************************/
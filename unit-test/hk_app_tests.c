@@ -26,6 +26,7 @@
 #include "hk_version.h"
 #include "hk_msgids.h"
 #include "hk_utils.h"
+#include "hk_dispatch.h"
 #include "hk_test_utils.h"
 
 /* UT includes */
@@ -39,6 +40,16 @@
 
 uint8 call_count_CFE_EVS_SendEvent;
 
+/*
+ * Handles a message as a housekeeping request would, deferring the table
+ * check, and sets the receive batch limit now that HK_AppInit has run
+ */
+void UT_HK_AppPipe_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    HK_AppData.RecvBatchLimit    = *(uint16 *)UserObj;
+    HK_AppData.TableCheckPending = true;
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_AppMain                                      */
@@ -251,6 +262,103 @@ void Test_HK_AppMain_RcvBufTimeoutCheckFail(void)
     UtAssert_INT32_EQ(HK_AppData.RunStatus, CFE_ES_RunStatus_APP_ERROR);
 }
 
+/*
+ * Function under test: HK_AppMain
+ *
+ * Case: Tests a receive batch that ends when the pipe is empty, with
+ *       the deferred table check done once at the end of the batch.
+ */
+void Test_HK_AppMain_RecvBatch(void)
+{
+    /* Arrange */
+    uint16 RecvBatchLimit = 3;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDefaultReturnValue(UT_KEY(HK_ProcessNewCopyTable), CFE_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, false);
+
+    /* Two messages are queued, the third poll finds the pipe empty */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+    UT_SetHandlerFunction(UT_KEY(HK_AppPipe), UT_HK_AppPipe_Handler, &RecvBatchLimit);
+
+    /* Act */
+    HK_AppMain();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(HK_AppPipe, 2);
+    UtAssert_STUB_COUNT(HK_CheckStatusOfTables, 1);
+    UtAssert_UINT32_EQ(HK_AppData.PeakRecvBatch, 2);
+    UtAssert_BOOL_FALSE(HK_AppData.TableCheckPending);
+
+    /* The empty pipe is not reported as an error */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(HK_AppData.RunStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+/*
+ * Function under test: HK_AppMain
+ *
+ * Case: Tests a receive batch that ends at the batch limit while
+ *       messages are still queued.
+ */
+void Test_HK_AppMain_RecvBatchLimit(void)
+{
+    /* Arrange */
+    uint16 RecvBatchLimit = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDefaultReturnValue(UT_KEY(HK_ProcessNewCopyTable), CFE_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, false);
+
+    UT_SetHandlerFunction(UT_KEY(HK_AppPipe), UT_HK_AppPipe_Handler, &RecvBatchLimit);
+
+    /* Act */
+    HK_AppMain();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(HK_AppPipe, 2);
+    UtAssert_STUB_COUNT(HK_CheckStatusOfTables, 1);
+    UtAssert_UINT32_EQ(HK_AppData.PeakRecvBatch, 2);
+    UtAssert_INT32_EQ(HK_AppData.RunStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+/*
+ * Function under test: HK_AppMain
+ *
+ * Case: Tests the case in which the table check deferred to the end of
+ *       the receive batch fails.
+ */
+void Test_HK_AppMain_RecvBatchCheckFail(void)
+{
+    /* Arrange */
+    uint16 RecvBatchLimit = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDefaultReturnValue(UT_KEY(HK_ProcessNewCopyTable), CFE_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, false);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UT_SetHandlerFunction(UT_KEY(HK_AppPipe), UT_HK_AppPipe_Handler, &RecvBatchLimit);
+    UT_SetDefaultReturnValue(UT_KEY(HK_CheckStatusOfTables), !HK_SUCCESS);
+
+    /* Act */
+    HK_AppMain();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(HK_CheckStatusOfTables, 1);
+    UtAssert_BOOL_FALSE(HK_AppData.TableCheckPending);
+    UtAssert_INT32_EQ(HK_AppData.RunStatus, CFE_ES_RunStatus_APP_ERROR);
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_AppInit                                      */
@@ -284,6 +392,7 @@ void Test_HK_AppInit_Success(void)
 
     /* Assert */
     UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(HK_AppData.RecvBatchLimit, HK_RECV_BATCH_LIMIT);
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
@@ -886,10 +995,17 @@ void Test_HK_TableInit_ProcessNewCpyTblFail(void)
 void Test_HK_ResetHkData(void)
 {
     /* Arrange */
-    HK_AppData.CmdCounter          = 1;
-    HK_AppData.ErrCounter          = 1;
-    HK_AppData.CombinedPacketsSent = 1;
-    HK_AppData.MissingDataCtr      = 1;
+    HK_AppData.CmdCounter           = 1;
+    HK_AppData.ErrCounter           = 1;
+    HK_AppData.CombinedPacketsSent  = 1;
+    HK_AppData.MissingDataCtr       = 1;
+    HK_AppData.MaxInputProcTime     = 1;
+    HK_AppData.InputProcTimeTotal   = 1;
+    HK_AppData.InputProcCount       = 1;
+    HK_AppData.MaxSendTime          = 1;
+    HK_AppData.MaxTableSwapTime     = 1;
+    HK_AppData.PeakRecvBatch        = 1;
+    HK_AppData.UnchangedPktsSkipped = 1;
 
     /* Act */
     HK_ResetHkData();
@@ -899,6 +1015,13 @@ void Test_HK_ResetHkData(void)
     UtAssert_INT32_EQ(HK_AppData.ErrCounter, 0);
     UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 0);
     UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 0);
+    UtAssert_UINT32_EQ(HK_AppData.MaxInputProcTime, 0);
+    UtAssert_UINT32_EQ(HK_AppData.InputProcTimeTotal, 0);
+    UtAssert_UINT32_EQ(HK_AppData.InputProcCount, 0);
+    UtAssert_UINT32_EQ(HK_AppData.MaxSendTime, 0);
+    UtAssert_UINT32_EQ(HK_AppData.MaxTableSwapTime, 0);
+    UtAssert_INT32_EQ(HK_AppData.PeakRecvBatch, 0);
+    UtAssert_INT32_EQ(HK_AppData.UnchangedPktsSkipped, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
@@ -920,6 +1043,10 @@ void UtTest_Setup(void)
     UtTest_Add(Test_HK_AppMain_RcvBufTimeout, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppMain_RcvBufTimeout");
     UtTest_Add(Test_HK_AppMain_RcvBufTimeoutCheckFail, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_AppMain_RcvBufTimeoutCheckFail");
+    UtTest_Add(Test_HK_AppMain_RecvBatch, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppMain_RecvBatch");
+    UtTest_Add(Test_HK_AppMain_RecvBatchLimit, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppMain_RecvBatchLimit");
+    UtTest_Add(Test_HK_AppMain_RecvBatchCheckFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_AppMain_RecvBatchCheckFail");
 
     /* Test functions for HK_AppInit */
     UtTest_Add(Test_HK_AppInit_Success, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppInit_Success");
@@ -63,6 +63,31 @@ void Test_HK_SendCombinedPktCmd(void)
     UtAssert_STUB_COUNT(HK_SendCombinedHkPacket, 1);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_WakeupCmd                                    */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_WakeupCmd
+ *
+ * Case: Tests the nominal case of the HK_WakeupCmd.  Note that
+ *       the function under test has no branches.
+ */
+void Test_HK_WakeupCmd(void)
+{
+    HK_WakeupCmd_t msgbuf;
+
+    memset(&msgbuf, 0, sizeof(msgbuf));
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_WakeupCmd(&msgbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(HK_SendScheduledPackets, 1);
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_SendHkCmd                              */
@@ -84,11 +109,13 @@ void Test_HK_SendHkCmd(void)
     HK_HkTlm_Payload_t *PayloadPtr;
 
     /* Setup app data values */
-    HK_AppData.CmdCounter          = 1;
-    HK_AppData.ErrCounter          = 2;
-    HK_AppData.MissingDataCtr      = 3;
-    HK_AppData.CombinedPacketsSent = 4;
-    HK_AppData.MemPoolHandle       = HK_UT_MEMPOOL_1;
+    HK_AppData.CmdCounter           = 1;
+    HK_AppData.ErrCounter           = 2;
+    HK_AppData.MissingDataCtr       = 3;
+    HK_AppData.CombinedPacketsSent  = 4;
+    HK_AppData.MemPoolHandle        = HK_UT_MEMPOOL_1;
+    HK_AppData.PeakRecvBatch        = 5;
+    HK_AppData.UnchangedPktsSkipped = 6;
 
     memset(&Msg, 0, sizeof(Msg));
 
@@ -106,6 +133,9 @@ void Test_HK_SendHkCmd(void)
     UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, PayloadPtr->CombinedPacketsSent);
     UtAssert_True(CFE_RESOURCEID_TEST_EQUAL(HK_AppData.MemPoolHandle, PayloadPtr->MemPoolHandle),
                   "CFE_RESOURCEID_TEST_EQUAL(HK_AppData.MemPoolHandle, PayloadPtr->MemPoolHandle)");
+    UtAssert_INT32_EQ(HK_AppData.PeakRecvBatch, PayloadPtr->PeakRecvBatch);
+    UtAssert_INT32_EQ(HK_AppData.UnchangedPktsSkipped, PayloadPtr->UnchangedPktsSkipped);
+    UtAssert_UINT32_EQ(PayloadPtr->AvgInputProcTime, 0);
 
     UtAssert_INT32_EQ(call_count_CFE_SB_TimeStampMsg, 1);
     UtAssert_INT32_EQ(call_count_CFE_SB_TransmitMsg, 1);
@@ -120,6 +150,148 @@ void Test_HK_SendHkCmd(void)
     UtAssert_UINT32_EQ(HK_AppData.RunStatus, CFE_ES_RunStatus_APP_ERROR);
 }
 
+/*
+ * Function under test: HK_SendHkCmd
+ *
+ * Case: Tests that the table check is left to the end of the receive
+ *       batch when more than one message is handled per batch.
+ */
+void Test_HK_SendHkCmd_RecvBatch(void)
+{
+    /* Arrange */
+    HK_SendHkCmd_t Msg;
+
+    HK_AppData.RecvBatchLimit = 4;
+
+    memset(&Msg, 0, sizeof(Msg));
+
+    /* Act */
+    HK_SendHkCmd(&Msg);
+
+    /* Assert */
+    UtAssert_BOOL_TRUE(HK_AppData.TableCheckPending);
+    UtAssert_STUB_COUNT(HK_CheckStatusOfTables, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+/*
+ * Function under test: HK_SendHkCmd
+ *
+ * Case: Tests that the timing statistics are converted to microseconds
+ *       in the housekeeping packet.
+ */
+void Test_HK_SendHkCmd_TimingStats(void)
+{
+    /* Arrange */
+    HK_SendHkCmd_t      Msg;
+    HK_HkTlm_Payload_t *PayloadPtr;
+
+    HK_AppData.MaxInputProcTime   = 100;
+    HK_AppData.InputProcTimeTotal = 100;
+    HK_AppData.InputProcCount     = 4;
+    HK_AppData.MaxSendTime        = 200;
+    HK_AppData.MaxTableSwapTime   = 300;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 7);
+
+    memset(&Msg, 0, sizeof(Msg));
+
+    /* Act */
+    HK_SendHkCmd(&Msg);
+
+    /* Assert */
+    PayloadPtr = &HK_AppData.HkPacket.Payload;
+    UtAssert_UINT32_EQ(PayloadPtr->MaxInputProcTime, 7);
+    UtAssert_UINT32_EQ(PayloadPtr->AvgInputProcTime, 7);
+    UtAssert_UINT32_EQ(PayloadPtr->MaxSendTime, 7);
+    UtAssert_UINT32_EQ(PayloadPtr->MaxTableSwapTime, 7);
+    UtAssert_STUB_COUNT(CFE_TIME_Sub2MicroSecs, 4);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SendAllCombinedPktsCmd                       */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SendAllCombinedPktsCmd
+ *
+ * Case: Tests the nominal case of the HK_SendAllCombinedPktsCmd.
+ */
+void Test_HK_SendAllCombinedPktsCmd(void)
+{
+    HK_SendAllCombinedPktsCmd_t msgbuf;
+
+    memset(&msgbuf, 0, sizeof(msgbuf));
+    msgbuf.Payload.NumPkts      = 1;
+    msgbuf.Payload.OutMsgIds[0] = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+
+    UT_SetDefaultReturnValue(UT_KEY(HK_SendAllCombinedPackets), 1);
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SendAllCombinedPktsCmd(&msgbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(HK_SendAllCombinedPackets, 1);
+    UtAssert_UINT8_EQ(HK_AppData.CmdCounter, 1);
+    UtAssert_UINT8_EQ(HK_AppData.ErrCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_SEND_ALL_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+}
+
+/*
+ * Function under test: HK_SendAllCombinedPktsCmd
+ *
+ * Case: Tests that a command naming more than HK_SEND_ALL_MAX_PKTS
+ *       packets is rejected.
+ */
+void Test_HK_SendAllCombinedPktsCmd_TooMany(void)
+{
+    HK_SendAllCombinedPktsCmd_t msgbuf;
+
+    memset(&msgbuf, 0, sizeof(msgbuf));
+    msgbuf.Payload.NumPkts = HK_SEND_ALL_MAX_PKTS + 1;
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SendAllCombinedPktsCmd(&msgbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(HK_SendAllCombinedPackets, 0);
+    UtAssert_UINT8_EQ(HK_AppData.CmdCounter, 0);
+    UtAssert_UINT8_EQ(HK_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_SEND_ALL_NUM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+/*
+ * Function under test: HK_SendAllCombinedPktsCmd
+ *
+ * Case: Tests that a command that sends no packet is not counted as
+ *       successful.
+ */
+void Test_HK_SendAllCombinedPktsCmd_NoneSent(void)
+{
+    HK_SendAllCombinedPktsCmd_t msgbuf;
+
+    memset(&msgbuf, 0, sizeof(msgbuf));
+
+    UT_SetDefaultReturnValue(UT_KEY(HK_SendAllCombinedPackets), 0);
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SendAllCombinedPktsCmd(&msgbuf), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(HK_SendAllCombinedPackets, 1);
+    UtAssert_UINT8_EQ(HK_AppData.CmdCounter, 0);
+    UtAssert_UINT8_EQ(HK_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_SEND_ALL_NONE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_NoopCmd                                      */
@@ -210,8 +382,20 @@ void UtTest_Setup(void)
     /* Test functions for HK_SendCombinedHkPacket */
     UtTest_Add(Test_HK_SendCombinedPktCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendCombinedPktCmd");
 
+    /* Test functions for HK_WakeupCmd */
+    UtTest_Add(Test_HK_WakeupCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_WakeupCmd");
+
     /* Test functions for HK_SendHkCmd */
     UtTest_Add(Test_HK_SendHkCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendHkCmd");
+    UtTest_Add(Test_HK_SendHkCmd_RecvBatch, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendHkCmd_RecvBatch");
+    UtTest_Add(Test_HK_SendHkCmd_TimingStats, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendHkCmd_TimingStats");
+
+    /* Test functions for HK_SendAllCombinedPktsCmd */
+    UtTest_Add(Test_HK_SendAllCombinedPktsCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendAllCombinedPktsCmd");
+    UtTest_Add(Test_HK_SendAllCombinedPktsCmd_TooMany, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SendAllCombinedPktsCmd_TooMany");
+    UtTest_Add(Test_HK_SendAllCombinedPktsCmd_NoneSent, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SendAllCombinedPktsCmd_NoneSent");
 
     /* Test functions for HK_NoopCmd */
     UtTest_Add(Test_HK_NoopCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_NoopCmd");
@@ -121,6 +121,70 @@ void Test_HK_AppPipe_SendHkCmd(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+/*
+ * Function under test: HK_AppPipe
+ *
+ * Case: Tests the case in which a Command message is received with a
+ *       "Wakeup" command code, with and without the expected length.
+ */
+void Test_HK_AppPipe_WakeupCmd(void)
+{
+    CFE_SB_Buffer_t Buf;
+
+    memset(&Buf, 0, sizeof(Buf));
+    HK_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HK_CMD_MID), HK_WAKEUP_CC, sizeof(HK_WakeupCmd_t));
+
+    /* Act */
+    HK_AppPipe(&Buf);
+
+    UtAssert_STUB_COUNT(HK_WakeupCmd, 1);
+    UtAssert_ZERO(HK_AppData.ErrCounter);
+
+    /* Bad Length */
+    HK_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HK_CMD_MID), HK_WAKEUP_CC, 1);
+
+    /* Act */
+    HK_AppPipe(&Buf);
+
+    UtAssert_STUB_COUNT(HK_WakeupCmd, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_CMD_LEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT8_EQ(HK_AppData.ErrCounter, 1);
+}
+
+/*
+ * Function under test: HK_AppPipe
+ *
+ * Case: Tests the case in which a Command message is received with a
+ *       "Send All Combined Packets" command code.
+ */
+void Test_HK_AppPipe_SendAllCombinedPktsCmd(void)
+{
+    CFE_SB_Buffer_t Buf;
+
+    memset(&Buf, 0, sizeof(Buf));
+    HK_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HK_CMD_MID), HK_SEND_ALL_COMBINED_PKTS_CC,
+                              sizeof(HK_SendAllCombinedPktsCmd_t));
+
+    /* Act */
+    HK_AppPipe(&Buf);
+
+    UtAssert_STUB_COUNT(HK_SendAllCombinedPktsCmd, 1);
+    UtAssert_ZERO(HK_AppData.ErrCounter);
+
+    /* Bad Length */
+    HK_Dispatch_Test_SetupMsg(CFE_SB_ValueToMsgId(HK_CMD_MID), HK_SEND_ALL_COMBINED_PKTS_CC, 1);
+
+    /* Act */
+    HK_AppPipe(&Buf);
+
+    UtAssert_STUB_COUNT(HK_SendAllCombinedPktsCmd, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_CMD_LEN_ERR_EID);
+    UtAssert_UINT8_EQ(HK_AppData.ErrCounter, 1);
+}
+
 /*
  * Function under test: HK_AppPipe
  *
@@ -236,6 +300,9 @@ void UtTest_Setup(void)
     UtTest_Add(Test_HK_AppPipe_SendCombinedPktCmd, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_AppPipe_SendCombinedPktCmd");
     UtTest_Add(Test_HK_AppPipe_SendHkCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppPipe_SendHkCmd");
+    UtTest_Add(Test_HK_AppPipe_WakeupCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppPipe_WakeupCmd");
+    UtTest_Add(Test_HK_AppPipe_SendAllCombinedPktsCmd, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_AppPipe_SendAllCombinedPktsCmd");
     UtTest_Add(Test_HK_AppPipe_NoopCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppPipe_NoopCmd");
     UtTest_Add(Test_HK_AppPipe_ResetCountersCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppPipe_ResetCountersCmd");
     UtTest_Add(Test_HK_AppPipe_UnknownCmd, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AppPipe_UnknownCmd");
@@ -42,6 +42,9 @@
 HK_RuntimeTableEntry_t NewRtTblPtr[HK_COPY_TABLE_ENTRIES];
 HK_CopyTableEntry_t    NewCopyTblPtr[HK_COPY_TABLE_ENTRIES];
 uint8                  call_count_CFE_EVS_SendEvent;
+CFE_TIME_SysTime_t     UT_ElapsedTime;
+CFE_TIME_SysTime_t     UT_MetTime;
+CFE_SB_Buffer_t *      UT_AllocatedBuffer;
 
 /*
  * Function Definitions
@@ -56,6 +59,21 @@ void UT_CFE_TBL_GetAddress_Handler(void *UserObj, UT_EntryKey_t FuncKey, const U
     HK_AppData.RuntimeTablePtr = NewRtTblPtr;
 }
 
+void UT_CFE_SB_AllocateMessageBuffer_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UT_AllocatedBuffer);
+}
+
+void UT_CFE_TIME_Subtract_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UT_ElapsedTime);
+}
+
+void UT_CFE_TIME_GetMET_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UT_MetTime);
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_ProcessIncomingHkData                        */
@@ -86,13 +104,20 @@ void Test_HK_ProcessIncomingHkData_MidNotFound(void)
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
     /* Act */
     HK_ProcessIncomingHkData(&Buf);
+    HK_SyncDataPresentFlags(RtTblPtr);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
 
     /* there should be no data present because the MID was not found in the
      * table */
@@ -135,6 +160,10 @@ void Test_HK_ProcessIncomingHkData_LengthOkEqual(void)
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes);
 
@@ -143,11 +172,14 @@ void Test_HK_ProcessIncomingHkData_LengthOkEqual(void)
 
     /* Act */
     HK_ProcessIncomingHkData(&Buf);
+    HK_SyncDataPresentFlags(RtTblPtr);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
 
     /* there should be one piece of data present because the MID was found in the
      * table and the length was valid */
@@ -193,6 +225,10 @@ void Test_HK_ProcessIncomingHkData_LengthOkGreater(void)
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes) + 2;
 
@@ -201,6 +237,7 @@ void Test_HK_ProcessIncomingHkData_LengthOkGreater(void)
 
     /* Act */
     HK_ProcessIncomingHkData(&Buf);
+    HK_SyncDataPresentFlags(RtTblPtr);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -248,6 +285,10 @@ void Test_HK_ProcessIncomingHkData_MessageError(void)
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes) - 2;
 
@@ -259,6 +300,7 @@ void Test_HK_ProcessIncomingHkData_MessageError(void)
 
     /* Act */
     HK_ProcessIncomingHkData(&Buf);
+    HK_SyncDataPresentFlags(RtTblPtr);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -285,1661 +327,4745 @@ void Test_HK_ProcessIncomingHkData_MessageError(void)
     UtAssert_INT32_EQ(NumEntriesWithDataPresent, 0);
 }
 
-/**********************************************************************/
-/*                                                                    */
-/* Test functions for HK_ValidateHkCopyTable                          */
-/*                                                                    */
-/**********************************************************************/
-
 /*
- * Function under test: HK_ValidateHkCopyTable
+ * Function under test: HK_ProcessIncomingHkData
  *
- * Case: Tests that the HK_ValidateHkCopyTable returns HK_SUCCESS
+ * Case: Tests the case where the provided Message ID feeds more than one
+ *       copy table entry; every entry fed by it must be updated.
  */
-
-void Test_HK_ValidateHkCopyTable_Success(void)
+void Test_HK_ProcessIncomingHkData_MultipleEntries(void)
 {
     /* Arrange */
-    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    int32                  i;
+    int32                  NumEntriesWithDataPresent = 0;
+    CFE_SB_MsgId_t         forced_MsgID;
+    size_t                 forced_Size;
+    CFE_SB_Buffer_t        Buf;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
-    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_SUCCESS);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
+    /* Entries 0 and 4 are both fed by this MID */
+    forced_MsgID = CopyTblPtr[0].InputMid;
+    forced_Size  = (CopyTblPtr[0].InputOffset + CopyTblPtr[0].NumBytes);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Act */
+    HK_ProcessIncomingHkData(&Buf);
+    HK_SyncDataPresentFlags(RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 1);
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].DataPresent == HK_DATA_PRESENT)
+        {
+            NumEntriesWithDataPresent++;
+        }
+    }
+
+    UtAssert_INT32_EQ(NumEntriesWithDataPresent, 2);
+    UtAssert_INT32_EQ(RtTblPtr[0].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[4].DataPresent, HK_DATA_PRESENT);
 }
 
 /*
- * Function under test: HK_ValidateHkCopyTable
+ * Function under test: HK_ProcessIncomingHkData
  *
- * Case: Tests that the HK_ValidateHkCopyTable returns HK_ERROR
+ * Case: Tests the case where adjacent rows were merged into one copy
+ *       operation and the packet only holds some of them.
  */
-
-void Test_HK_ValidateHkCopyTable_Error(void)
+void Test_HK_ProcessIncomingHkData_MergedShortPacket(void)
 {
     /* Arrange */
-    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint8                  i;
+    CFE_SB_MsgId_t         forced_MsgID;
+    size_t                 forced_Size;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint8                  InputPkt[64];
+    uint8                  OutputPkt[64];
 
-    /* Make it bad in several different ways */
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
 
-    /* Check output exceeding bounds */
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    CopyTblPtr[1].OutputOffset = HK_MAX_COMBINED_PACKET_SIZE;
-    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+    /* Three adjacent 4 byte fields, merged into one operation */
+    for (i = 0; i < 3; i++)
+    {
+        CopyTblPtr[i].InputMid     = HK_UT_MID_100;
+        CopyTblPtr[i].InputOffset  = 12 + (4 * i);
+        CopyTblPtr[i].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+        CopyTblPtr[i].OutputOffset = 20 + (4 * i);
+        CopyTblPtr[i].NumBytes     = 4;
+        RtTblPtr[i].OutputPktAddr  = CFE_ES_MEMADDRESS_C(OutputPkt);
+    }
 
-    /* Check input exceeding bounds */
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    CopyTblPtr[0].InputOffset = HK_MAX_COMBINED_PACKET_SIZE;
-    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+    for (i = 0; i < sizeof(InputPkt); i++)
+    {
+        InputPkt[i] = i;
+    }
+    memset(OutputPkt, 0, sizeof(OutputPkt));
 
-    /* Check output MID missing */
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    CopyTblPtr[1].OutputMid = CFE_SB_INVALID_MSG_ID;
-    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    /* Check input MID missing */
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    CopyTblPtr[0].InputMid = CFE_SB_INVALID_MSG_ID;
-    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
+    /* Long enough for the first two fields only */
+    forced_MsgID = HK_UT_MID_100;
+    forced_Size  = 20;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Act */
+    HK_ProcessIncomingHkData((CFE_SB_Buffer_t *)InputPkt);
+    HK_SyncDataPresentFlags(RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.NumCopyOps, 1);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_ACCESSING_PAST_PACKET_END_EID);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[1].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[2].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_MemCmp(&OutputPkt[20], &InputPkt[12], 8, "First two fields copied");
+    UtAssert_UINT8_EQ(OutputPkt[28], 0);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_ProcessNewCopyTable                          */
+/* Test functions for HK_SortEntryList                                */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_SortEntryList
  *
- * Case: Tests the case where the provided Copy Table Pointer is NULL.
+ * Case: Tests that the rows are ordered by input MID and that rows with
+ *       the same input MID keep their copy table order.
  */
-void Test_HK_ProcessNewCopyTable_NullCpyTbl(void)
+void Test_HK_SortEntryList_Stable(void)
 {
     /* Arrange */
-    HK_RuntimeTableEntry_t RtTblPtr;
-    int32                  strCmpResult;
-    CFE_Status_t           ReturnValue;
+    int32               i;
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint16              EntryList[5] = {0, 1, 2, 3, 4};
 
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Null pointer detected in new copy tbl processing: CpyTbl = %%p, RtTbl = %%p");
+    CopyTblPtr[0].InputMid = HK_UT_MID_100;
+    CopyTblPtr[1].InputMid = HK_UT_MID_101;
+    CopyTblPtr[2].InputMid = HK_UT_MID_100;
+    CopyTblPtr[3].InputMid = HK_UT_MID_101;
+    CopyTblPtr[4].InputMid = HK_UT_MID_100;
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(NULL, &RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_SortEntryList(EntryList, 5, CopyTblPtr, HK_CompareInputMid);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_NEWCPY_ERR_EID);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_UINT16_EQ(EntryList[0], 0);
+    UtAssert_UINT16_EQ(EntryList[1], 2);
+    UtAssert_UINT16_EQ(EntryList[2], 4);
+    UtAssert_UINT16_EQ(EntryList[3], 1);
+    UtAssert_UINT16_EQ(EntryList[4], 3);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    for (i = 1; i < 5; i++)
+    {
+        UtAssert_True(HK_CompareInputMid(&CopyTblPtr[EntryList[i - 1]], &CopyTblPtr[EntryList[i]]) <= 0,
+                      "Entry %d is in order", (int)i);
+    }
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_LowerBoundEntryList                          */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_LowerBoundEntryList
  *
- * Case: Tests the case where the provided RT Table Pointer is NULL.
+ * Case: Tests that the search finds the first row of a run of equal
+ *       rows, and the end of the list for a key above every row.
  */
-void Test_HK_ProcessNewCopyTable_NullRtTbl(void)
+void Test_HK_LowerBoundEntryList(void)
 {
     /* Arrange */
-    HK_CopyTableEntry_t CpyTblPtr;
-    int32               strCmpResult;
-    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    CFE_Status_t        ReturnValue;
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Null pointer detected in new copy tbl processing: CpyTbl = %%p, RtTbl = %%p");
-
-    /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(&CpyTblPtr, NULL);
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t Key;
+    uint16              EntryList[5] = {0, 2, 4, 1, 3};
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+    CopyTblPtr[0].InputMid = HK_UT_MID_100;
+    CopyTblPtr[1].InputMid = HK_UT_MID_101;
+    CopyTblPtr[2].InputMid = HK_UT_MID_100;
+    CopyTblPtr[3].InputMid = HK_UT_MID_101;
+    CopyTblPtr[4].InputMid = HK_UT_MID_100;
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    memset(&Key, 0, sizeof(Key));
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_NEWCPY_ERR_EID);
+    /* Act and Assert */
+    Key.InputMid = HK_UT_MID_100;
+    UtAssert_UINT16_EQ(HK_LowerBoundEntryList(EntryList, 5, CopyTblPtr, &Key, HK_CompareInputMid), 0);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    Key.InputMid = HK_UT_MID_101;
+    UtAssert_UINT16_EQ(HK_LowerBoundEntryList(EntryList, 5, CopyTblPtr, &Key, HK_CompareInputMid), 3);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    Key.InputMid = CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(HK_UT_MID_101) + 1);
+    UtAssert_UINT16_EQ(HK_LowerBoundEntryList(EntryList, 5, CopyTblPtr, &Key, HK_CompareInputMid), 5);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_UINT16_EQ(HK_LowerBoundEntryList(EntryList, 0, CopyTblPtr, &Key, HK_CompareInputMid), 0);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_BuildInputIndex                              */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_BuildInputIndex
  *
- * Case: Tests the case where the call to CFE_ES_GetPoolBuf fails.
+ * Case: Tests that rows sharing an input MID are grouped into a single
+ *       index entry and that the index is sorted by MID.
  */
-void Test_HK_ProcessNewCopyTable_PoolBufFail(void)
+void Test_HK_BuildInputIndex_Success(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        ExtraSubscribes = 0;
-    int          strCmpResult;
-
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
+    int32                  i;
+    uint16                 Loop;
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    HK_InputIndexEntry_t * IndexEntry;
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "HK Processing New Table: ES_GetPoolBuf for size %%d returned 0x%%04X");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), (CFE_SUCCESS - 1));
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_UINT16_EQ(HK_AppData.NumInputIndexEntries, 4);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 5);
-
-    for (i = 0; i < 5; i++)
+    for (i = 1; i < HK_AppData.NumInputIndexEntries; i++)
     {
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventID, HK_MEM_POOL_MALLOC_FAILED_EID);
-
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventType, CFE_EVS_EventType_ERROR);
-
-        strCmpResult =
-            strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[i].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-        UtAssert_True(strCmpResult == 0, "Event #%d string matched expected result, '%s'", (int)i,
-                      context_CFE_EVS_SendEvent[i].Spec);
+        UtAssert_True(CFE_SB_MsgIdToValue(HK_AppData.InputIndex[i - 1].InputMid) <
+                          CFE_SB_MsgIdToValue(HK_AppData.InputIndex[i].InputMid),
+                      "Index entry %d is sorted", (int)i);
     }
 
-    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-
-    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    for (i = 0; i < HK_AppData.NumInputIndexEntries; i++)
     {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        IndexEntry = &HK_AppData.InputIndex[i];
+
+        for (Loop = 0; Loop < IndexEntry->NumEntries; Loop++)
         {
-            ExtraSubscribes++;
+            UtAssert_True(CFE_SB_MsgId_Equal(
+                              CopyTblPtr[HK_AppData.InputEntryList[IndexEntry->FirstEntry + Loop]].InputMid,
+                              IndexEntry->InputMid),
+                          "Index entry %d row %d has matching MID", (int)i, (int)Loop);
+        }
+
+        if (CFE_SB_MsgId_Equal(IndexEntry->InputMid, CopyTblPtr[0].InputMid))
+        {
+            UtAssert_UINT16_EQ(IndexEntry->NumEntries, 2);
+            UtAssert_UINT16_EQ(HK_AppData.InputEntryList[IndexEntry->FirstEntry], 0);
+            UtAssert_UINT16_EQ(HK_AppData.InputEntryList[IndexEntry->FirstEntry + 1], 4);
+        }
+        else
+        {
+            UtAssert_UINT16_EQ(IndexEntry->NumEntries, 1);
         }
     }
-    UtAssert_INT32_EQ(ExtraSubscribes, 0);
 }
 
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_BuildInputIndex
  *
- * Case: Tests the case where the call to CFE_SB_Subscribe fails.
+ * Case: Tests that rows without an output packet are left out of the index.
  */
-void Test_HK_ProcessNewCopyTable_SubscribeFail(void)
+void Test_HK_BuildInputIndex_NoOutputPacket(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int          strCmpResult;
-    int32        i;
-    int32        SubscriptionCount = 0;
-
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "HK Processing New Table:SB_Subscribe for Mid 0x%%08lX returned 0x%%04X");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_Subscribe), !CFE_SUCCESS);
-
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+    RtTblPtr[2].OutputPktAddr = CFE_ES_MEMADDRESS_C(NULL);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_UINT16_EQ(HK_AppData.NumInputIndexEntries, 3);
+    UtAssert_NULL(HK_FindInputIndex(CopyTblPtr[2].InputMid));
+}
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 5);
+/*
+ * Function under test: HK_BuildInputIndex
+ *
+ * Case: Tests that an empty copy table produces an empty index.
+ */
+void Test_HK_BuildInputIndex_EmptyTable(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    for (i = 0; i < 5; i++)
-    {
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventID, HK_CANT_SUBSCRIBE_TO_SB_PKT_EID);
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
 
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventType, CFE_EVS_EventType_ERROR);
+    /* Act */
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
 
-        strCmpResult =
-            strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[i].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.NumInputIndexEntries, 0);
+}
 
-        UtAssert_True(strCmpResult == 0, "Event #%d string matched expected result, '%s'", (int)i,
-                      context_CFE_EVS_SendEvent[i].Spec);
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CompileCopyProgram                           */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CompileCopyProgram
+ *
+ * Case: Tests that rows adjacent in both packets are merged into one
+ *       operation even when they are not in table order, and that rows
+ *       which are not adjacent are kept as separate operations.
+ */
+void Test_HK_CompileCopyProgram_Merge(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t      RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t         CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint8                       OutputPkt[64];
+    const HK_InputIndexEntry_t *IndexEntry;
+    int32                       i;
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+
+    /* Rows 0..2 form one run listed out of order, row 3 is not adjacent */
+    CopyTblPtr[0].InputOffset  = 16;
+    CopyTblPtr[0].OutputOffset = 24;
+    CopyTblPtr[1].InputOffset  = 12;
+    CopyTblPtr[1].OutputOffset = 20;
+    CopyTblPtr[2].InputOffset  = 20;
+    CopyTblPtr[2].OutputOffset = 28;
+    CopyTblPtr[3].InputOffset  = 24;
+    CopyTblPtr[3].OutputOffset = 40;
+
+    for (i = 0; i < 4; i++)
+    {
+        CopyTblPtr[i].InputMid    = HK_UT_MID_100;
+        CopyTblPtr[i].OutputMid   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+        CopyTblPtr[i].NumBytes    = 4;
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(OutputPkt);
+    }
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+
+    /* Act */
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
+    /* Assert */
+    IndexEntry = HK_FindInputIndex(HK_UT_MID_100);
+    UtAssert_NOT_NULL(IndexEntry);
+    UtAssert_UINT16_EQ(HK_AppData.NumCopyOps, 2);
+    UtAssert_UINT16_EQ(IndexEntry->NumOps, 2);
+    UtAssert_UINT32_EQ(IndexEntry->MinLength, 28);
+
+    UtAssert_ADDRESS_EQ(HK_AppData.CopyOps[0].DestPtr, &OutputPkt[20]);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[0].InputOffset, 12);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[0].NumBytes, 12);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[0].NumEntries, 3);
+
+    UtAssert_ADDRESS_EQ(HK_AppData.CopyOps[1].DestPtr, &OutputPkt[40]);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[1].InputOffset, 24);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[1].NumBytes, 4);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[1].NumEntries, 1);
+}
+
+/*
+ * Function under test: HK_CompileCopyProgram
+ *
+ * Case: Tests that each output packet descriptor lists exactly the copy
+ *       operations that write the packet.
+ */
+void Test_HK_CompileCopyProgram_PktOps(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    const HK_CopyOp_t *    CopyOp;
+    int32                  i;
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* Make the last entry a second combined packet */
+    CopyTblPtr[4].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[4].OutputOffset = 12;
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    /* Act */
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.NumOutputPkts, 2);
+    UtAssert_UINT16_EQ(HK_AppData.NumCopyOps, 5);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].NumOps, 4);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].NumOps, 1);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].FirstOp, 4);
+
+    for (i = 0; i < 5; i++)
+    {
+        CopyOp = &HK_AppData.CopyOps[HK_AppData.PktOpList[i]];
+        UtAssert_UINT16_EQ(CopyOp->OutputPkt, (i < 4) ? 0 : 1);
+    }
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_FindInputIndex                               */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_FindInputIndex
+ *
+ * Case: Tests that every input MID in the copy table can be found.
+ */
+void Test_HK_FindInputIndex_Found(void)
+{
+    /* Arrange */
+    int32                       i;
+    HK_RuntimeTableEntry_t      RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t         CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    const HK_InputIndexEntry_t *IndexEntry;
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+
+    for (i = 0; i < 5; i++)
+    {
+        /* Act */
+        IndexEntry = HK_FindInputIndex(CopyTblPtr[i].InputMid);
+
+        /* Assert */
+        UtAssert_NOT_NULL(IndexEntry);
+        if (IndexEntry != NULL)
+        {
+            UtAssert_True(CFE_SB_MsgId_Equal(IndexEntry->InputMid, CopyTblPtr[i].InputMid),
+                          "Found index entry for row %d", (int)i);
+        }
     }
+}
+
+/*
+ * Function under test: HK_FindInputIndex
+ *
+ * Case: Tests that a MID that is not in the copy table is not found.
+ */
+void Test_HK_FindInputIndex_NotFound(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+
+    /* Act */
+    /* Assert */
+    UtAssert_NULL(HK_FindInputIndex(HK_UT_MID_100));
+    UtAssert_NULL(HK_FindInputIndex(CFE_SB_INVALID_MSG_ID));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ValidateHkCopyTable                          */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_ValidateHkCopyTable
+ *
+ * Case: Tests that the HK_ValidateHkCopyTable returns HK_SUCCESS
+ */
+
+void Test_HK_ValidateHkCopyTable_Success(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_SUCCESS);
+}
+
+/*
+ * Function under test: HK_ValidateHkCopyTable
+ *
+ * Case: Tests that the HK_ValidateHkCopyTable returns HK_ERROR
+ */
+
+void Test_HK_ValidateHkCopyTable_Error(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    /* Make it bad in several different ways */
+
+    /* Check output exceeding bounds */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[1].OutputOffset = HK_MAX_COMBINED_PACKET_SIZE;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check input exceeding bounds */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[0].InputOffset = HK_MAX_COMBINED_PACKET_SIZE;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check output MID missing */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[1].OutputMid = CFE_SB_INVALID_MSG_ID;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check input MID missing */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[0].InputMid = CFE_SB_INVALID_MSG_ID;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check output overwriting the message header */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[0].OutputOffset = HK_OUTPUT_HDR_SIZE - 1;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check two rows writing overlapping bytes of the same packet */
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    CopyTblPtr[3].OutputOffset = CopyTblPtr[1].OutputOffset + 2;
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+
+    /* Check output packets that do not fit in the memory pool */
+    HK_Test_InitPoolOverflowCopyTable(CopyTblPtr);
+    UtAssert_INT32_EQ(HK_ValidateHkCopyTable(CopyTblPtr), HK_ERROR);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_FindOutputOverlap                            */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_FindOutputOverlap
+ *
+ * Case: Tests that adjacent rows and rows of different packets do not
+ *       overlap while a row starting inside a longer row of its packet does.
+ */
+void Test_HK_FindOutputOverlap(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint16              EntryIdx = 0;
+    uint16              OtherIdx = 0;
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    /* Same offset in another packet, and a row that copies nothing */
+    CopyTblPtr[2].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[2].OutputOffset = CopyTblPtr[1].OutputOffset;
+    CopyTblPtr[4].NumBytes     = 0;
+    CopyTblPtr[4].OutputOffset = CopyTblPtr[1].OutputOffset;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(HK_FindOutputOverlap(CopyTblPtr, HK_COPY_TABLE_ENTRIES, &EntryIdx, &OtherIdx));
+
+    /* Row 0 now extends over row 1 */
+    CopyTblPtr[0].NumBytes = 12;
+    UtAssert_BOOL_TRUE(HK_FindOutputOverlap(CopyTblPtr, HK_COPY_TABLE_ENTRIES, &EntryIdx, &OtherIdx));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(EntryIdx, 1);
+    UtAssert_UINT32_EQ(OtherIdx, 0);
+
+    /* Rows past the ones checked are left out */
+    UtAssert_BOOL_FALSE(HK_FindOutputOverlap(CopyTblPtr, 1, &EntryIdx, &OtherIdx));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_FindOutputPoolOverflow                       */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_FindOutputPoolOverflow
+ *
+ * Case: Tests that the pool bytes of every packet are added up and that
+ *       the first packet past the end of the pool is found.
+ */
+void Test_HK_FindOutputPoolOverflow(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint16              EntryIdx  = 0;
+    uint32              PoolBytes = 0;
+    uint16              NumPkts;
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_FindOutputPoolOverflow(CopyTblPtr, HK_COPY_TABLE_ENTRIES, &EntryIdx, &PoolBytes));
+    UtAssert_UINT32_EQ(PoolBytes, HK_OUTPUT_BLOCK_SIZE(CopyTblPtr[4].OutputOffset + CopyTblPtr[4].NumBytes));
+
+    NumPkts = HK_Test_InitPoolOverflowCopyTable(CopyTblPtr);
+    UtAssert_BOOL_TRUE(HK_FindOutputPoolOverflow(CopyTblPtr, HK_COPY_TABLE_ENTRIES, &EntryIdx, &PoolBytes));
+    UtAssert_UINT32_EQ(EntryIdx, NumPkts - 1);
+    UtAssert_UINT32_EQ(PoolBytes, NumPkts * HK_OUTPUT_BLOCK_SIZE(HK_MAX_COMBINED_PACKET_SIZE));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CountCopyTableRows                           */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CountCopyTableRows
+ *
+ * Case: Tests that the count stops at the last populated row and
+ *       includes unused rows in the middle of the table.
+ */
+void Test_HK_CountCopyTableRows(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    UtAssert_UINT32_EQ(HK_CountCopyTableRows(CopyTblPtr), 0);
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    UtAssert_UINT32_EQ(HK_CountCopyTableRows(CopyTblPtr), 5);
+
+    /* A row with only an output MsgId still counts */
+    CopyTblPtr[1].InputMid  = CFE_SB_INVALID_MSG_ID;
+    CopyTblPtr[9].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    UtAssert_UINT32_EQ(HK_CountCopyTableRows(CopyTblPtr), 10);
+
+    CopyTblPtr[HK_COPY_TABLE_ENTRIES - 1].InputMid = CFE_SB_ValueToMsgId(CFE_ES_HK_TLM_MID);
+    UtAssert_UINT32_EQ(HK_CountCopyTableRows(CopyTblPtr), HK_COPY_TABLE_ENTRIES);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ProcessNewCopyTable                          */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the provided Copy Table Pointer is NULL.
+ */
+void Test_HK_ProcessNewCopyTable_NullCpyTbl(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr;
+    int32                  strCmpResult;
+    CFE_Status_t           ReturnValue;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Null pointer detected in new copy tbl processing: CpyTbl = %%p, RtTbl = %%p");
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(NULL, &RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_NEWCPY_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the provided RT Table Pointer is NULL.
+ */
+void Test_HK_ProcessNewCopyTable_NullRtTbl(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CpyTblPtr;
+    int32               strCmpResult;
+    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CFE_Status_t        ReturnValue;
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Null pointer detected in new copy tbl processing: CpyTbl = %%p, RtTbl = %%p");
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(&CpyTblPtr, NULL);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_NEWCPY_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the call to CFE_ES_GetPoolBuf fails.
+ */
+void Test_HK_ProcessNewCopyTable_PoolBufFail(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        ExtraSubscribes = 0;
+    int          strCmpResult;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "HK Processing New Table: ES_GetPoolBuf for size %%d returned 0x%%04X");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), (CFE_SUCCESS - 1));
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    /* All entries share one output packet, so the allocation is only attempted once */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_MALLOC_FAILED_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            ExtraSubscribes++;
+        }
+    }
+    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the call to CFE_SB_Subscribe fails.
+ */
+void Test_HK_ProcessNewCopyTable_SubscribeFail(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int          strCmpResult;
+    int32        i;
+    int32        SubscriptionCount = 0;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "HK Processing New Table:SB_Subscribe for Mid 0x%%08lX returned 0x%%04X");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_Subscribe), !CFE_SUCCESS);
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    /* Entries 0 and 4 share an input MsgId, so only four subscriptions are attempted */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 4);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 4);
+
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventID, HK_CANT_SUBSCRIBE_TO_SB_PKT_EID);
+
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventType, CFE_EVS_EventType_ERROR);
+
+        strCmpResult =
+            strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[i].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+        UtAssert_True(strCmpResult == 0, "Event #%d string matched expected result, '%s'", (int)i,
+                      context_CFE_EVS_SendEvent[i].Spec);
+    }
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            SubscriptionCount++;
+        }
+    }
+    UtAssert_INT32_EQ(SubscriptionCount, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests that the run-time rows used by a larger previous table
+ *       are cleared and that the populated row count is updated.
+ */
+void Test_HK_ProcessNewCopyTable_ShrinkTable(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    HK_AppData.NumCopyTableRows    = 10;
+    RtTblPtr[9].InputMidSubscribed = HK_INPUTMID_SUBSCRIBED;
+    RtTblPtr[9].DataPresent        = HK_DATA_PRESENT;
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_AppData.NumCopyTableRows, 5);
+    UtAssert_INT32_EQ(RtTblPtr[9].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[9].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the HK_ProcessNewCopyTable succeeds.
+ *       Note that this function has multiple branches that lead to
+ *       success. In this case, all populated Copy Table entries
+ *       have the InputMid and OutputMid defined.
+ */
+void Test_HK_ProcessNewCopyTable_Success(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        ExtraSubscribes = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    /* One packet per output MsgId and one subscription per distinct input MsgId */
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 4);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            ExtraSubscribes++;
+        }
+    }
+    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case where the HK_ProcessNewCopyTable succeeds.
+ *       Note that this function has multiple branches that lead to
+ *       success. In this case, one of the populated Copy Table entries
+ *       has an undefined InputMid and a defined OutputMid (forces
+ *       a different logical branch than the previous success case).
+ */
+void Test_HK_ProcessNewCopyTable_Success2(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        ExtraSubscribes = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    CopyTblPtr[1].InputMid = CFE_SB_INVALID_MSG_ID;
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            ExtraSubscribes++;
+        }
+    }
+
+    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case in which one populated copy table entry
+ *       has a size of 0.
+ */
+void Test_HK_ProcessNewCopyTable_PacketSizeZero(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        ExtraSubscribes = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    CopyTblPtr[1].OutputOffset = 0;
+    CopyTblPtr[1].NumBytes     = 0;
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            ExtraSubscribes++;
+        }
+    }
+    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case in which all populated copy table entries
+ *       have a size of 0.
+ */
+void Test_HK_ProcessNewCopyTable_AllPacketsSizeZero(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        ExtraSubscribes = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+
+    for (i = 0; i < 5; i++)
+    {
+        CopyTblPtr[i].OutputOffset = 0;
+        CopyTblPtr[i].NumBytes     = 0;
+    }
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            ExtraSubscribes++;
+        }
+    }
+
+    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+}
+
+/*
+ * Function under test: HK_ProcessNewCopyTable
+ *
+ * Case: Tests the case in which the copy table has no populated
+ *       entries.
+ */
+void Test_HK_ProcessNewCopyTable_EmptyTable(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        SubscriptionCount = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+
+    /* Act */
+    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            SubscriptionCount++;
+        }
+    }
+
+    UtAssert_INT32_EQ(SubscriptionCount, 0);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_TearDownOldCopyTable                         */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_TearDownCopyTable
+ *
+ * Case: Tests the case where the provided Copy Table Pointer is NULL.
+ */
+void Test_HK_TearDownOldCopyTable_NullCpyTbl(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr;
+    int32                  strCmpResult;
+    CFE_Status_t           ReturnValue;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Null pointer detected in copy tbl tear down: CpyTbl = %%p, RtTbl = %%p");
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(NULL, &RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_TEARCPY_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_TearDownCopyTable
+ *
+ * Case: Tests the case where the provided Runtime Table Pointer is NULL.
+ */
+void Test_HK_TearDownOldCopyTable_NullRtTbl(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CpyTblPtr;
+    int32               strCmpResult;
+    CFE_Status_t        ReturnValue;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Null pointer detected in copy tbl tear down: CpyTbl = %%p, RtTbl = %%p");
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(&CpyTblPtr, NULL);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_TEARCPY_ERR_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_TearDownCopyTable
+ *
+ * Case: Tests the case where the call to CFE_ES_PutPoolBuf fails.
+ */
+void Test_HK_TearDownOldCopyTable_PoolFreeFail(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int          strCmpResult;
+
+    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "HK TearDown: ES_putPoolBuf Err pkt:0x%%08lX ret 0x%%04X, hdl 0x%%08lx");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PutPoolBuf), (CFE_SUCCESS - 1));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    /* All entries share one output packet, so the free is only attempted once */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_TearDownOldCopyTable
+ *
+ * Case: Tests that a failed free does not stop the other packets of the
+ *       same output MsgId from being freed and all entries being cleared.
+ */
+void Test_HK_TearDownOldCopyTable_PoolFreeFailContinues(void)
+{
+    /* Arrange */
+    CFE_Status_t           ReturnValue;
+    CFE_SB_Buffer_t        OtherBuffer;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    uint16                 Loop;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PutPoolBuf), (CFE_SUCCESS - 1));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* A second packet for the same output MsgId */
+    RtTblPtr[3].OutputPktAddr = CFE_ES_MEMADDRESS_C(&OtherBuffer);
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+
+    for (Loop = 0; Loop < HK_COPY_TABLE_ENTRIES; Loop++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[Loop].OutputPktAddr));
+    }
+}
+
+/*
+ * Function under test: HK_TearDownOldCopyTable
+ *
+ * Case: Tests the case where the HK_TearDownOldCopyTable succeeds.
+ *       Note that this function has multiple branches that lead to
+ *       success. In this case, all of the populated Runtime Table
+ *       entries have the same OutputPktAddr.
+ */
+void Test_HK_TearDownOldCopyTable_Success(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    /* One free per output packet and one unsubscribe per distinct input MsgId */
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 4);
+
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr));
+        UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    }
+}
+
+/*
+ * Function under test: HK_TearDownOldCopyTable
+ *
+ * Case: Tests the case where the provided Copy Table and
+ *       Runtime Table have no populated entries.
+ */
+void Test_HK_TearDownOldCopyTable_EmptyTable(void)
+{
+    /* Arrange */
+    CFE_Status_t ReturnValue;
+    int32        i;
+    int32        SubscriptionCount = 0;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        {
+            SubscriptionCount++;
+        }
+    }
+
+    UtAssert_INT32_EQ(SubscriptionCount, 0);
+}
+
+/*
+ * Function under test: HK_TearDownOldCopyTable
+ *
+ * Case: Tests the case where the HK_TearDownOldCopyTable succeeds.
+ *       Note that this function has multiple branches that lead to
+ *       success. In this case, one of the populated Runtime Table
+ *       entries has a different OutputPktAddr than the other
+ *       populated entries (forcing a different logical path).
+ */
+void Test_HK_TearDownOldCopyTable_Success2(void)
+{
+    /* Arrange */
+    CFE_Status_t           ReturnValue;
+    int32                  i;
+    CFE_SB_Buffer_t        Buffer;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    RtTblPtr[4].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* Just needs to not match the
+                                      other filled entries */
+
+    /* Act */
+    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr));
+        UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    }
+}
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SavePrevCopyTable                            */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SavePrevCopyTable
+ *
+ * Case: Tests the case where a table pointer is NULL.
+ */
+void Test_HK_SavePrevCopyTable_NullTbl(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SavePrevCopyTable(NULL, RtTblPtr), HK_NULL_POINTER_DETECTED);
+
+    /* Assert */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_TEARCPY_ERR_EID);
+    UtAssert_UINT32_EQ(HK_AppData.NumPrevRows, 0);
+}
+
+/*
+ * Function under test: HK_SavePrevCopyTable
+ *
+ * Case: Tests that the rows are saved with their packets and
+ *       subscriptions, and that nothing is freed or unsubscribed.
+ */
+void Test_HK_SavePrevCopyTable_Success(void)
+{
+    /* Arrange */
+    int32                  i;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    RtTblPtr[2].DataPresent = HK_DATA_PRESENT;
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_AppData.NumPrevRows, HK_COPY_TABLE_ENTRIES);
+    UtAssert_UINT32_EQ(HK_AppData.NumPrevOutputRows, 5);
+    UtAssert_UINT32_EQ(HK_AppData.NumPrevInputRows, 5);
+    UtAssert_INT32_EQ(HK_AppData.PrevRuntimeTable[2].DataPresent, HK_DATA_PRESENT);
+
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr));
+        UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+        UtAssert_INT32_EQ(RtTblPtr[i].DataPresent, HK_DATA_NOT_PRESENT);
+    }
+}
+
+/*
+ * Function under test: HK_SavePrevCopyTable
+ *
+ * Case: Tests that the saved rows are kept when the previous update
+ *       did not reach the processing of the new table.
+ */
+void Test_HK_SavePrevCopyTable_PrevNotProcessed(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_AppData.NumPrevRows = 3;
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_AppData.NumPrevRows, 3);
+    UtAssert_NOT_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[0].OutputPktAddr));
+}
+#endif
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_AllocArenaPkt                                */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_AllocArenaPkt
+ *
+ * Case: Tests that packets are carved one after the other, aligned, until
+ *       the rest of the pool is too small.
+ */
+void Test_HK_AllocArenaPkt(void)
+{
+    /* Arrange */
+    size_t FirstSize = HK_OUTPUT_BLOCK_SIZE(20);
+
+    /* Act and Assert */
+    UtAssert_ADDRESS_EQ(HK_AllocArenaPkt(20), &HK_AppData.MemPoolBuffer.Data[0]);
+    UtAssert_UINT32_EQ(HK_AppData.ArenaUsed, FirstSize);
+
+    UtAssert_ADDRESS_EQ(HK_AllocArenaPkt(8), &HK_AppData.MemPoolBuffer.Data[FirstSize]);
+    UtAssert_UINT32_EQ(HK_AppData.ArenaUsed, FirstSize + HK_OUTPUT_BLOCK_SIZE(8));
+
+    UtAssert_NULL(HK_AllocArenaPkt(sizeof(HK_AppData.MemPoolBuffer.Data)));
+    UtAssert_UINT32_EQ(HK_AppData.ArenaUsed, FirstSize + HK_OUTPUT_BLOCK_SIZE(8));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_AllocOutputPkt                               */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_AllocOutputPkt
+ *
+ * Case: Tests that the packet comes from the HK memory pool and that a
+ *       failed allocation leaves no buffer.
+ */
+void Test_HK_AllocOutputPkt(void)
+{
+    /* Arrange */
+    CFE_SB_Buffer_t *BufPtr = NULL;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Act and Assert */
+    UtAssert_INT32_EQ(HK_AllocOutputPkt(&BufPtr, 20), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(BufPtr);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+}
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ReusePrevOutputPkt                           */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_ReusePrevOutputPkt
+ *
+ * Case: Tests that a packet with the same rows is taken over and that
+ *       each row records the saved row it keeps the data of.
+ */
+void Test_HK_ReusePrevOutputPkt_Unchanged(void)
+{
+    /* Arrange */
+    int32                  i;
+    void *                 Buffer;
+    uint16                 EntryList[5] = {0, 1, 2, 3, 4};
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    Buffer = CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[0].OutputPktAddr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+
+    /* Act */
+    UtAssert_ADDRESS_EQ(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 5), Buffer);
+
+    /* Assert */
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_UINT16_EQ(HK_AppData.CarryRow[i], i);
+        UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[i].OutputPktAddr), Buffer);
+    }
+}
+
+/*
+ * Function under test: HK_ReusePrevOutputPkt
+ *
+ * Case: Tests that a packet with a changed row, or with fewer rows,
+ *       is not taken over.
+ */
+void Test_HK_ReusePrevOutputPkt_Changed(void)
+{
+    /* Arrange */
+    uint16                 EntryList[5] = {0, 1, 2, 3, 4};
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+
+    /* Act and Assert */
+    UtAssert_NULL(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 4));
+
+    CopyTblPtr[2].NumBytes = 2;
+    UtAssert_NULL(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 5));
+
+    UtAssert_NOT_NULL(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[0].OutputPktAddr));
+}
+
+/*
+ * Function under test: HK_ReusePrevOutputPkt
+ *
+ * Case: Tests that a packet freed to make room for the new table is not
+ *       taken over.
+ */
+void Test_HK_ReusePrevOutputPkt_Freed(void)
+{
+    /* Arrange */
+    uint16                 EntryList[5] = {0, 1, 2, 3, 4};
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    memset(HK_AppData.CarryRow, 0xFF, sizeof(HK_AppData.CarryRow));
+    HK_FreePrevOutputPkts();
+
+    /* Act */
+    UtAssert_NULL(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 5));
+
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.CarryRow[0], HK_NO_PREV_ROW);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_FreePrevOutputPkts                           */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_FreePrevOutputPkts
+ *
+ * Case: Tests that a saved packet that is not kept is freed once and
+ *       removed from every saved row.
+ */
+void Test_HK_FreePrevOutputPkts_NotKept(void)
+{
+    /* Arrange */
+    int32                  i;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    memset(HK_AppData.CarryRow, 0xFF, sizeof(HK_AppData.CarryRow));
+
+    /* Act */
+    UtAssert_BOOL_TRUE(HK_FreePrevOutputPkts());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[i].OutputPktAddr));
+    }
+
+    UtAssert_BOOL_FALSE(HK_FreePrevOutputPkts());
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+}
+
+/*
+ * Function under test: HK_FreePrevOutputPkts
+ *
+ * Case: Tests that a saved packet already taken over by the new table is
+ *       not freed, and that a failed free is reported.
+ */
+void Test_HK_FreePrevOutputPkts_Kept(void)
+{
+    /* Arrange */
+    int32                  i;
+    uint16                 EntryList[5] = {0, 1, 2, 3, 4};
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    memset(HK_AppData.CarryRow, 0xFF, sizeof(HK_AppData.CarryRow));
+    UtAssert_NOT_NULL(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 5));
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_FreePrevOutputPkts());
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* Not kept, and the free fails */
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_AppData.NumPrevRows = 0;
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    memset(HK_AppData.CarryRow, 0xFF, sizeof(HK_AppData.CarryRow));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PutPoolBuf), -1);
+
+    UtAssert_BOOL_TRUE(HK_FreePrevOutputPkts());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[i].OutputPktAddr));
+    }
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_KeepPrevSubscription                         */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_KeepPrevSubscription
+ *
+ * Case: Tests that a subscription is taken from every saved row of its
+ *       input MsgId, and that an input MsgId that was not subscribed is
+ *       not kept.
+ */
+void Test_HK_KeepPrevSubscription(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    NewEntry;
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+
+    /* Act and Assert */
+    UtAssert_BOOL_TRUE(HK_KeepPrevSubscription(&CopyTblPtr[0]));
+
+    UtAssert_INT32_EQ(HK_AppData.PrevRuntimeTable[0].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    UtAssert_INT32_EQ(HK_AppData.PrevRuntimeTable[4].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
+    UtAssert_INT32_EQ(HK_AppData.PrevRuntimeTable[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+
+    NewEntry          = CopyTblPtr[0];
+    NewEntry.InputMid = HK_UT_MID_100;
+    UtAssert_BOOL_FALSE(HK_KeepPrevSubscription(&NewEntry));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CarryPrevData                                */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CarryPrevData
+ *
+ * Case: Tests that a row of a changed packet gets the data of a saved
+ *       row of the same input field that had data present, and that the
+ *       saved rows keep their packet so that it is freed.
+ */
+void Test_HK_CarryPrevData_ChangedPkt(void)
+{
+    /* Arrange */
+    int32                  i;
+    uint8                  PrevPkt[40];
+    uint8                  NewPkt[40];
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(PrevPkt, 0, sizeof(PrevPkt));
+    memset(NewPkt, 0, sizeof(NewPkt));
+    memset(&PrevPkt[16], 0x5A, 4);
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    for (i = 0; i < 5; i++)
+    {
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(PrevPkt);
+    }
+
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    HK_AppData.PrevRuntimeTable[1].DataPresent = HK_DATA_PRESENT;
+
+    /* The new table moves the data of row 1 */
+    CopyTblPtr[1].OutputOffset = 32;
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        HK_AppData.CarryRow[i] = HK_NO_PREV_ROW;
+    }
+    for (i = 0; i < 5; i++)
+    {
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(NewPkt);
+    }
+
+    /* Act */
+    HK_CarryPrevData(CopyTblPtr, RtTblPtr);
+
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.CarryRow[1], 1);
+    UtAssert_UINT16_EQ(HK_AppData.CarryRow[0], HK_NO_PREV_ROW);
+    UtAssert_UINT16_EQ(HK_AppData.CarryRow[2], HK_NO_PREV_ROW);
+    UtAssert_INT32_EQ(memcmp(&NewPkt[32], &PrevPkt[16], 4), 0);
+    UtAssert_UINT32_EQ(NewPkt[16], 0);
+    UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[1].OutputPktAddr), PrevPkt);
+}
+
+/*
+ * Function under test: HK_CarryPrevData
+ *
+ * Case: Tests that a kept packet is removed from the saved rows.
+ */
+void Test_HK_CarryPrevData_KeptPkt(void)
+{
+    /* Arrange */
+    int32                  i;
+    uint8                  PrevPkt[40];
+    uint16                 EntryList[5] = {0, 1, 2, 3, 4};
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    for (i = 0; i < 5; i++)
+    {
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(PrevPkt);
+    }
+
+    HK_SavePrevCopyTable(CopyTblPtr, RtTblPtr);
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        HK_AppData.CarryRow[i] = HK_NO_PREV_ROW;
+    }
+
+    UtAssert_ADDRESS_EQ(HK_ReusePrevOutputPkt(CopyTblPtr, EntryList, 5), PrevPkt);
+    for (i = 0; i < 5; i++)
+    {
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(PrevPkt);
+    }
+
+    /* Act */
+    HK_CarryPrevData(CopyTblPtr, RtTblPtr);
+
+    /* Assert */
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_UINT16_EQ(HK_AppData.CarryRow[i], i);
+        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(HK_AppData.PrevRuntimeTable[i].OutputPktAddr));
+    }
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_RestoreCarriedData                           */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_RestoreCarriedData
+ *
+ * Case: Tests that only rows that kept the data of a saved row with
+ *       data present get their data present bit and refresh time.
+ */
+void Test_HK_RestoreCarriedData(void)
+{
+    /* Arrange */
+    HK_AppData.NumCopyTableRows = 3;
+    HK_AppData.CarryRow[0]      = 7;
+    HK_AppData.CarryRow[1]      = 8;
+    HK_AppData.CarryRow[2]      = HK_NO_PREV_ROW;
+    HK_AppData.OutputBitPos[0]  = 1;
+    HK_AppData.OutputBitPos[1]  = 2;
+    HK_AppData.OutputBitPos[2]  = 0;
+
+    HK_AppData.PrevRuntimeTable[7].DataPresent = HK_DATA_PRESENT;
+    HK_AppData.PrevRuntimeTable[8].DataPresent = HK_DATA_NOT_PRESENT;
+#if HK_STALE_DATA_CHECK == 1
+    HK_AppData.PrevRefreshTime[7] = 42;
+#endif
+
+    /* Act */
+    HK_RestoreCarriedData();
+
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_AppData.DataPresentBits[0], 0x2);
+#if HK_STALE_DATA_CHECK == 1
+    UtAssert_UINT32_EQ(HK_AppData.RefreshTime[1], 42);
+#endif
+}
+#endif
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_MatchGenCopyTable                            */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_MatchGenCopyTable
+ *
+ * Case: Tests that a loaded table equal to the generated one, with every
+ *       output packet created, matches.
+ */
+void Test_HK_MatchGenCopyTable_Match(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    GenTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodCopyTable(GenTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_AppData.NumCopyTableRows = 5;
+
+    /* Act and Assert */
+    UtAssert_BOOL_TRUE(HK_MatchGenCopyTable(CopyTblPtr, RtTblPtr, GenTblPtr, 5));
+}
+
+/*
+ * Function under test: HK_MatchGenCopyTable
+ *
+ * Case: Tests that a changed row, a different number of rows or a missing
+ *       output packet make the loaded table fall back to the interpreter.
+ */
+void Test_HK_MatchGenCopyTable_Differs(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    GenTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodCopyTable(GenTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_AppData.NumCopyTableRows = 5;
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_MatchGenCopyTable(CopyTblPtr, RtTblPtr, GenTblPtr, 4));
+
+    GenTblPtr[2].NumBytes++;
+    UtAssert_BOOL_FALSE(HK_MatchGenCopyTable(CopyTblPtr, RtTblPtr, GenTblPtr, 5));
+
+    GenTblPtr[2].NumBytes--;
+    RtTblPtr[3].OutputPktAddr = CFE_ES_MEMADDRESS_C(NULL);
+    UtAssert_BOOL_FALSE(HK_MatchGenCopyTable(CopyTblPtr, RtTblPtr, GenTblPtr, 5));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SendCombinedHkPacket                         */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SendCombinedHkPacket
+ *
+ * Case: Tests the case where the HK_SendCombinedHkPacket function
+ *       does not see any missing data.
+ */
+void Test_HK_SendCombinedHkPacket_NoMissingData(void)
+{
+    /* Arrange */
+    int32          call_count_CFE_SB_TimeStampMsg;
+    int32          call_count_CFE_SB_TransmitMsg;
+    CFE_SB_MsgId_t SendMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
+    int32          i;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    for (i = 0; i < 5; i++)
+    {
+        HK_Test_SetEntryDataPresent(i);
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &SendMid, sizeof(SendMid), false);
+
+    /* Act */
+    HK_SendCombinedHkPacket(SendMid);
+
+    call_count_CFE_EVS_SendEvent   = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    call_count_CFE_SB_TimeStampMsg = UT_GetStubCount(UT_KEY(CFE_SB_TimeStampMsg));
+    call_count_CFE_SB_TransmitMsg  = UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
+    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 0);
+    UtAssert_INT32_EQ(call_count_CFE_SB_TimeStampMsg, 1);
+    UtAssert_INT32_EQ(call_count_CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+}
+
+/*
+ * Function under test: HK_SendCombinedHkPacket
+ *
+ * Case: Tests the case where the HK_SendCombinedHkPacket function
+ *       does see missing data.
+ */
+void Test_HK_SendCombinedHkPacket_MissingData(void)
+{
+    /* Arrange */
+    CFE_SB_MsgId_t SendMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &SendMid, sizeof(SendMid), false);
+
+    /* Act */
+    HK_SendCombinedHkPacket(SendMid);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 1);
+
+#if HK_DISCARD_INCOMPLETE_COMBO == 0
+    int32 call_count_CFE_SB_TimeStampMsg = UT_GetStubCount(UT_KEY(CFE_SB_TimeStampMsg));
+    int32 call_count_CFE_SB_TransmitMsg  = UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg));
+
+    UtAssert_INT32_EQ(call_count_CFE_SB_TimeStampMsg, 1);
+    UtAssert_INT32_EQ(call_count_CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+#endif
+}
+
+/*
+ * Function under test: HK_SendCombinedHkPacket
+ *
+ * Case: Tests the case where the HK_SendCombinedHkPacket function
+ *       is called with both the Copy Table and Runtime Table empty.
+ */
+void Test_HK_SendCombinedHkPacket_EmptyTable(void)
+{
+    /* Arrange */
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Combined HK Packet 0x%%08lX is not found in current HK Copy Table");
+
+    /* Act */
+    HK_SendCombinedHkPacket(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNKNOWN_COMBINED_PACKET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_SendCombinedHkPacket
+ *
+ * Case: Tests the case where the HK_SendCombinedHkPacket function
+ *       is called for a message that is not present in the Copy
+ *       Table.
+ */
+void Test_HK_SendCombinedHkPacket_PacketNotFound(void)
+{
+    /* Arrange */
+    CFE_SB_MsgId_t  forced_MsgID = HK_UT_MID_100; /* does not match provided parameter */
+    int32           strCmpResult;
+    char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    CFE_SB_Buffer_t Buffer;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+
+    /* populate one entry in the RT table */
+    RtTblPtr[1].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* just needs to be non-null */
+
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Combined HK Packet 0x%%08lX is not found in current HK Copy Table");
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+
+    /* Act */
+    HK_SendCombinedHkPacket(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNKNOWN_COMBINED_PACKET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SendAllCombinedPackets                       */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SendAllCombinedPackets
+ *
+ * Case: Tests that an empty list sends every combined packet, that a
+ *       list sends only the named ones, and that unknown MsgIds are
+ *       reported and skipped.
+ */
+void Test_HK_SendAllCombinedPackets(void)
+{
+    /* Arrange */
+    int32          i;
+    CFE_SB_MsgId_t MsgIds[2];
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    /* Make the last entry a second combined packet */
+    CopyTblPtr[4].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[4].OutputOffset = 12;
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    for (i = 0; i < 5; i++)
+    {
+        HK_Test_SetEntryDataPresent(i);
+    }
+
+    /* Act */
+    UtAssert_UINT16_EQ(HK_SendAllCombinedPackets(NULL, 0), 2);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
+
+    /* Name the second packet and one that is not in the table */
+    MsgIds[0] = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    MsgIds[1] = CFE_SB_ValueToMsgId(HK_COMBINED_PKT3_MID);
+
+    UtAssert_UINT16_EQ(HK_SendAllCombinedPackets(MsgIds, 2), 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNKNOWN_COMBINED_PACKET_EID);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SendOutputPkt                                */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SendOutputPkt
+ *
+ * Case: Tests that an incomplete packet is sent or discarded according
+ *       to its own incomplete packet policy.
+ */
+void Test_HK_SendOutputPkt_IncompletePolicy(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    /* Act */
+    HK_AppData.OutputPkts[0].DiscardIncomplete = true;
+    UtAssert_BOOL_FALSE(HK_SendOutputPkt(&HK_AppData.OutputPkts[0], false));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 1);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(HK_SendOutputPkt(&HK_AppData.OutputPkts[0], true));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Act */
+    HK_AppData.OutputPkts[0].DiscardIncomplete = false;
+    UtAssert_BOOL_TRUE(HK_SendOutputPkt(&HK_AppData.OutputPkts[0], false));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 2);
+    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 3);
+}
+
+/*
+ * Function under test: HK_SendOutputPkt
+ *
+ * Case: Tests that an unchanged packet with a heartbeat is counted as
+ *       skipped instead of being sent.
+ */
+void Test_HK_SendOutputPkt_Unchanged(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+    uint8               Buffer[32];
+    uint8               LastSent[32];
+
+    memset(Buffer, 0, sizeof(Buffer));
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.OutBuffer    = (CFE_SB_Buffer_t *)Buffer;
+    OutPkt.PacketSize   = sizeof(Buffer);
+    OutPkt.Heartbeat    = 2;
+    OutPkt.SkippedSends = 2;
+    OutPkt.LastSentData = LastSent;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(HK_SendOutputPkt(&OutPkt, false));
+    UtAssert_BOOL_FALSE(HK_SendOutputPkt(&OutPkt, false));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+    UtAssert_INT32_EQ(HK_AppData.UnchangedPktsSkipped, 1);
+}
+
+/*
+ * Function under test: HK_SendOutputPkt
+ *
+ * Case: Tests that a packet SB does not accept is reported and not
+ *       counted as sent.
+ */
+void Test_HK_SendOutputPkt_TransmitFail(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+    uint8               Buffer[32];
+
+    memset(Buffer, 0, sizeof(Buffer));
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.OutBuffer  = (CFE_SB_Buffer_t *)Buffer;
+    OutPkt.PacketSize = sizeof(Buffer);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_TransmitMsg), CFE_SB_BAD_ARGUMENT);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(HK_SendOutputPkt(&OutPkt, false));
+
+    /* Assert */
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_OUTPKT_SEND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SkipUnchangedPkt                             */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_SkipUnchangedPkt
+ *
+ * Case: Tests that an unchanged packet is skipped until its heartbeat
+ *       and that a changed packet is never skipped.
+ */
+void Test_HK_SkipUnchangedPkt(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+    uint8               Buffer[32];
+    uint8               LastSent[32];
+    size_t              HeaderSize = HK_OUTPUT_HDR_SIZE;
+
+    memset(Buffer, 0, sizeof(Buffer));
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.OutBuffer    = (CFE_SB_Buffer_t *)Buffer;
+    OutPkt.PacketSize   = sizeof(Buffer);
+    OutPkt.Heartbeat    = 3;
+    OutPkt.SkippedSends = 3;
+    OutPkt.LastSentData = LastSent;
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+    UtAssert_BOOL_TRUE(HK_SkipUnchangedPkt(&OutPkt));
+
+    /* A header change, such as the time stamp, is not a change */
+    Buffer[HeaderSize - 1] = 1;
+    UtAssert_BOOL_TRUE(HK_SkipUnchangedPkt(&OutPkt));
+
+    /* The heartbeat expires */
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+    UtAssert_UINT16_EQ(OutPkt.SkippedSends, 0);
+
+    /* A data change is sent at once */
+    UtAssert_BOOL_TRUE(HK_SkipUnchangedPkt(&OutPkt));
+    Buffer[HeaderSize] = 1;
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+
+    /* Changes that cancel out in a checksum are still changes */
+    Buffer[HeaderSize]     = 0;
+    Buffer[HeaderSize + 1] = 1;
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+    UtAssert_MemCmp(LastSent, &Buffer[HeaderSize], sizeof(Buffer) - HeaderSize, "Data sent is kept");
+}
+
+/*
+ * Function under test: HK_SkipUnchangedPkt
+ *
+ * Case: Tests that a packet without a heartbeat is never skipped.
+ */
+void Test_HK_SkipUnchangedPkt_NoHeartbeat(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+
+    memset(&OutPkt, 0, sizeof(OutPkt));
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+
+    /* A heartbeat without a copy of the data last sent is not used */
+    OutPkt.Heartbeat = 3;
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+    UtAssert_BOOL_FALSE(HK_SkipUnchangedPkt(&OutPkt));
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_AllocLastSentData                            */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_AllocLastSentData
+ *
+ * Case: Tests that a buffer for the data is allocated once, and that a
+ *       packet without data gets none.
+ */
+void Test_HK_AllocLastSentData(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.PacketSize = HK_OUTPUT_HDR_SIZE;
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_AllocLastSentData(&OutPkt));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+
+    /* The stub hands out a buffer for a positive size */
+    OutPkt.PacketSize = HK_OUTPUT_HDR_SIZE + 8;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), 8);
+    UtAssert_BOOL_TRUE(HK_AllocLastSentData(&OutPkt));
+    UtAssert_NOT_NULL(OutPkt.LastSentData);
+    UtAssert_BOOL_TRUE(HK_AllocLastSentData(&OutPkt));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+}
+
+/*
+ * Function under test: HK_AllocLastSentData
+ *
+ * Case: Tests that a failed allocation is reported.
+ */
+void Test_HK_AllocLastSentData_Fail(void)
+{
+    /* Arrange */
+    HK_OutputPktEntry_t OutPkt;
+
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.PacketSize = HK_OUTPUT_HDR_SIZE + 8;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Act and Assert */
+    UtAssert_BOOL_FALSE(HK_AllocLastSentData(&OutPkt));
+    UtAssert_NULL(OutPkt.LastSentData);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_MALLOC_FAILED_EID);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ReleaseLastSentData                          */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_ReleaseLastSentData
+ *
+ * Case: Tests that every kept copy is given back, and that a failure to
+ *       give one back is reported.
+ */
+void Test_HK_ReleaseLastSentData(void)
+{
+    /* Arrange */
+    uint8 LastSent[2][8];
+
+    HK_AppData.NumOutputPkts              = 3;
+    HK_AppData.OutputPkts[0].LastSentData = LastSent[0];
+    HK_AppData.OutputPkts[0].Heartbeat    = 2;
+    HK_AppData.OutputPkts[2].LastSentData = LastSent[1];
+    HK_AppData.OutputPkts[2].Heartbeat    = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 2, (CFE_SUCCESS - 1));
+
+    /* Act */
+    HK_ReleaseLastSentData();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_NULL(HK_AppData.OutputPkts[0].LastSentData);
+    UtAssert_NULL(HK_AppData.OutputPkts[2].LastSentData);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].Heartbeat, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CheckStatusOfTables                          */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CheckStatusOfTables
+ *
+ * Case: Tests the case where the HK_CheckStatusOfTables function
+ *       succeeds.
+ */
+void Test_HK_CheckStatusOfTables_AllSuccess(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfTables();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfTables
+ *
+ * Case: Tests the case in which the Copy Table fails its status check.
+ */
+void Test_HK_CheckStatusOfTables_CpyTblFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfTables();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfTables
+ *
+ * Case: Tests the case in which the Runtime Table fails its status check.
+ */
+void Test_HK_CheckStatusOfTables_RtTblFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 2, !CFE_SUCCESS); /* copy tbl will pass, rt tbl will fail */
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfTables();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CheckStatusOfCopyTable                       */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the status of the copy table is
+ *       CFE_SUCCESS.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblSuccess(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblStatFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_GetStatus return (0x%%08X) for Copy Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_GETSTAT_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_VALIDATION_PENDING, and the subsequent validation
+ *       succeeds.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblValPendingSuccess(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_VALIDATION_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Validate), CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_VALIDATION_PENDING, and the subsequent validation
+ *       fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblValPendingFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_Validate return (0x%%08X) for Copy Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_VALIDATION_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Validate), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_TBLVLD_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
+ *       CFE_TBL_ReleaseAddress fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblInfoUpReleaseFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_ReleaseAddress return (0x%%08X) for Copy Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_RELADDR_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
+ *       CFE_TBL_Update fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblInfoUpUpdateFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_Update return (0x%%08X) for Copy Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_TBLUPD_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
+ *       CFE_TBL_GetAddress fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblInfoUpGetAddrFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_GetAddress return (0x%%08X) for Copy Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), !CFE_TBL_INFO_UPDATED);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_GETADDR_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent processing of
+ *       the update fails.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblInfoUpProcessFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Process New Copy Table Failed, status = 0x%%08X");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 3);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HK_NEWCPYTBL_HK_FAILED_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[2].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[2].Spec);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfCopyTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent processing of
+ *       the update succeeds.
+ */
+void Test_HK_CheckStatusOfCopyTable_TblInfoUpProcessSuccess(void)
+{
+    /* Arrange */
+    int32                  ReturnValue;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), UT_CFE_TBL_GetAddress_Handler, NULL);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfCopyTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CheckStatusOfDumpTable                       */
+/*                                                                    */
+/**********************************************************************/
+
+/*
+ * Function under test: HK_CheckStatusOfDumpTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_SUCCESS.
+ */
+void Test_HK_CheckStatusOfDumpTable_TblStatSuccess(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfDumpTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfDumpTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       an error.
+ */
+void Test_HK_CheckStatusOfDumpTable_TblStatFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_GetStatus return (0x%%08X) for Runtime Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+
+    /* Act */
+    ReturnValue = HK_CheckStatusOfDumpTable();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
 
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
-    {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            SubscriptionCount++;
-        }
-    }
-    UtAssert_INT32_EQ(SubscriptionCount, 0);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_GETSTAT2_RET_EID);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_CheckStatusOfDumpTable
  *
- * Case: Tests the case where the HK_ProcessNewCopyTable succeeds.
- *       Note that this function has multiple branches that lead to
- *       success. In this case, all populated Copy Table entries
- *       have the InputMid and OutputMid defined.
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_DUMP_PENDING and the subsequent call to
+ *       CFE_TBL_DumpToBuffer succeeds.
  */
-void Test_HK_ProcessNewCopyTable_Success(void)
+void Test_HK_CheckStatusOfDumpTable_TblStatUpDumpSuccess(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        ExtraSubscribes = 0;
+    int32 ReturnValue;
 
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), CFE_SUCCESS);
 
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    /* Act */
+    ReturnValue = HK_CheckStatusOfDumpTable();
 
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Function under test: HK_CheckStatusOfDumpTable
+ *
+ * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
+ *       CFE_TBL_INFO_DUMP_PENDING and the subsequent call to
+ *       CFE_TBL_DumpToBuffer fails.
+ */
+void Test_HK_CheckStatusOfDumpTable_TblStatUpDumpFail(void)
+{
+    /* Arrange */
+    int32 ReturnValue;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Unexpected CFE_TBL_DumpToBuffer return (0x%%08X) for Runtime Table");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), !CFE_SUCCESS);
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+    ReturnValue = HK_CheckStatusOfDumpTable();
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 
-    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_DUMPTOBUFFER_RET_EID);
 
-    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
-    {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            ExtraSubscribes++;
-        }
-    }
-    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CheckForMissingData                          */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_CheckForMissingData
  *
- * Case: Tests the case where the HK_ProcessNewCopyTable succeeds.
- *       Note that this function has multiple branches that lead to
- *       success. In this case, one of the populated Copy Table entries
- *       has an undefined InputMid and a defined OutputMid (forces
- *       a different logical branch than the previous success case).
+ * Case: Tests the case in which missing data is detected because
+ *       table entries matching the output MID do not have data present.
  */
-void Test_HK_ProcessNewCopyTable_Success2(void)
+void Test_HK_CheckForMissingData_MissingData(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        ExtraSubscribes = 0;
+    int32                ReturnValue;
+    HK_OutputPktEntry_t *OutPktToCheck   = NULL;
+    CFE_SB_MsgId_t       MissingInputMid = CFE_SB_INVALID_MSG_ID;
+    uint16               NumMissing      = 0;
 
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
-
     HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    CopyTblPtr[1].InputMid = CFE_SB_INVALID_MSG_ID;
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    OutPktToCheck = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID)); /* MID in the table */
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid, &NumMissing);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
-
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(ReturnValue, HK_MISSING_DATA_DETECTED);
 
-    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    /* Check MissingInputMid is set correctly */
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(MissingInputMid), CFE_EVS_HK_TLM_MID);
+    UtAssert_UINT16_EQ(NumMissing, 5);
+}
 
-    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
-    {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            ExtraSubscribes++;
-        }
-    }
+/*
+ * Function under test: HK_CheckForMissingData
+ *
+ * Case: Tests the case in which no missing data is detected because
+ *       no table entries feed the packet.
+ */
+void Test_HK_CheckForMissingData_NoMissingData_NoEntries(void)
+{
+    /* Arrange */
+    int32               ReturnValue;
+    HK_OutputPktEntry_t OutPktToCheck;
+    CFE_SB_MsgId_t      MissingInputMid = CFE_SB_INVALID_MSG_ID;
+    uint16              NumMissing      = 0;
 
-    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    memset(&OutPktToCheck, 0, sizeof(OutPktToCheck));
+    OutPktToCheck.OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+
+    /* Act */
+    ReturnValue = HK_CheckForMissingData(&OutPktToCheck, &MissingInputMid, &NumMissing);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
+
+    /* check that the MissingInputMid did not change */
+    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_UINT16_EQ(NumMissing, 0);
 }
 
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_CheckForMissingData
  *
- * Case: Tests the case in which one populated copy table entry
- *       has a size of 0.
+ * Case: Tests the case in which no missing data is detected because
+ *       only entries of a different output packet lack data.
  */
-void Test_HK_ProcessNewCopyTable_PacketSizeZero(void)
+void Test_HK_CheckForMissingData_NoMissingData_OutputMidMismatch(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        ExtraSubscribes = 0;
+    int32                ReturnValue;
+    HK_OutputPktEntry_t *OutPktToCheck   = NULL;
+    CFE_SB_MsgId_t       MissingInputMid = CFE_SB_INVALID_MSG_ID;
+    uint16               NumMissing      = 0;
+    int32                i;
 
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
-
     HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    CopyTblPtr[1].OutputOffset = 0;
-    CopyTblPtr[1].NumBytes     = 0;
+    /* Entries 0 and 1 move to a second packet and have no data, the rest do */
+    CopyTblPtr[0].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[1].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    OutPktToCheck = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID));
+
+    for (i = 2; i < 5; i++)
+    {
+        HK_Test_SetEntryDataPresent(i);
+    }
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid, &NumMissing);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
-
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
 
-    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
+    /* check that the MissingInputMid did not change */
+    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_UINT16_EQ(NumMissing, 0);
+}
 
-    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+/*
+ * Function under test: HK_CheckForMissingData
+ *
+ * Case: Tests the case in which no missing data is detected because
+ *       table entries matching the Message ID have data present.
+ */
+void Test_HK_CheckForMissingData_NoMissingData_DataPresent(void)
+{
+    /* Arrange */
+    int32                ReturnValue;
+    HK_OutputPktEntry_t *OutPktToCheck   = NULL;
+    CFE_SB_MsgId_t       MissingInputMid = CFE_SB_INVALID_MSG_ID;
+    uint16               NumMissing      = 0;
+    int32                i;
+
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+
+    for (i = 0; i < 5; i++)
     {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            ExtraSubscribes++;
-        }
+        HK_Test_SetEntryDataPresent(i);
     }
-    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+    OutPktToCheck = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID)); /* MID in the table */
+
+    /* Act */
+    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid, &NumMissing);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
+
+    /* check that the MissingInputMid did not change */
+    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_UINT16_EQ(NumMissing, 0);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SetFlagsToNotPresent                         */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_SetFlagsToNotPresent
  *
- * Case: Tests the case in which all populated copy table entries
- *       have a size of 0.
+ * Case: Tests the nominal case of the HK_SetFlagsToNotPresent function.
  */
-void Test_HK_ProcessNewCopyTable_AllPacketsSizeZero(void)
+void Test_HK_SetFlagsToNotPresent(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        ExtraSubscribes = 0;
+    int32                  EntriesWithDataPresent = 0;
+    HK_RuntimeTableEntry_t RtTbl[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CpyTbl[HK_COPY_TABLE_ENTRIES];
+    CFE_SB_Buffer_t        Buffer;
+    int32                  i;
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        RtTbl[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* just needs to be non-null */
+        CpyTbl[i].OutputMid    = CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID);
+        CpyTbl[i].OutputOffset = 0;
+        CpyTbl[i].NumBytes     = 0;
+        RtTbl[i].DataPresent   = HK_DATA_NOT_PRESENT;
+    }
 
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    /* make it so that exactly one entry shouldn't have flags cleared */
+    CpyTbl[0].OutputMid = HK_UT_MID_100;
 
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    HK_AppData.CopyTablePtr    = CpyTbl;
+    HK_AppData.RuntimeTablePtr = RtTbl;
 
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_BuildOutputIndex(CpyTbl, RtTbl);
 
-    for (i = 0; i < 5; i++)
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
     {
-        CopyTblPtr[i].OutputOffset = 0;
-        CopyTblPtr[i].NumBytes     = 0;
+        HK_Test_SetEntryDataPresent(i);
     }
 
     /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
+    HK_SetFlagsToNotPresent(HK_FindOutputPkt(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID)));
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_SyncDataPresentFlags(RtTbl);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-
-    UtAssert_INT32_EQ(RtTblPtr[0].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[1].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[2].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[3].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-    UtAssert_INT32_EQ(RtTblPtr[4].InputMidSubscribed, HK_INPUTMID_SUBSCRIBED);
-
-    for (i = 5; i < HK_COPY_TABLE_ENTRIES; i++)
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
     {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        if (RtTbl[i].DataPresent == HK_DATA_PRESENT)
         {
-            ExtraSubscribes++;
+            EntriesWithDataPresent++;
         }
     }
 
-    UtAssert_INT32_EQ(ExtraSubscribes, 0);
+    UtAssert_INT32_EQ(EntriesWithDataPresent, 1);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_GetDataPresentMask                           */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_ProcessNewCopyTable
+ * Function under test: HK_GetDataPresentMask
  *
- * Case: Tests the case in which the copy table has no populated
- *       entries.
+ * Case: Tests ranges that cover, start in, end in and straddle a word.
  */
-void Test_HK_ProcessNewCopyTable_EmptyTable(void)
+void Test_HK_GetDataPresentMask(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        SubscriptionCount = 0;
+    /* Act */
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_GetDataPresentMask(0, 0, 32), 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(HK_GetDataPresentMask(0, 4, 8), 0x000000F0);
+    UtAssert_UINT32_EQ(HK_GetDataPresentMask(0, 30, 40), 0xC0000000);
+    UtAssert_UINT32_EQ(HK_GetDataPresentMask(1, 30, 40), 0x000000FF);
+    UtAssert_UINT32_EQ(HK_GetDataPresentMask(1, 0, 96), 0xFFFFFFFF);
+}
 
+/*
+ * Function under test: HK_CheckForMissingData
+ *
+ * Case: Tests a packet whose entries span more than one bitset word,
+ *       with entries missing in the second word only.
+ */
+void Test_HK_CheckForMissingData_SpansWords(void)
+{
+    /* Arrange */
+    int32                  ReturnValue;
+    HK_OutputPktEntry_t *  OutPktToCheck   = NULL;
+    CFE_SB_MsgId_t         MissingInputMid = CFE_SB_INVALID_MSG_ID;
+    uint16                 NumMissing      = 0;
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    CFE_SB_Buffer_t        Buffer;
+    int32                  i;
 
     HK_Test_InitEmptyCopyTable(CopyTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
 
-    /* Act */
-    ReturnValue = HK_ProcessNewCopyTable(CopyTblPtr, RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    for (i = 0; i < 40; i++)
+    {
+        CopyTblPtr[i].InputMid     = CFE_SB_ValueToMsgId(1 + i);
+        CopyTblPtr[i].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+        CopyTblPtr[i].OutputOffset = 12 + i;
+        CopyTblPtr[i].NumBytes     = 1;
+        RtTblPtr[i].OutputPktAddr  = CFE_ES_MEMADDRESS_C(&Buffer); /* just needs to be non-null */
+    }
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    OutPktToCheck = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID));
 
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    for (i = 0; i < 40; i++)
     {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
+        if ((i != 35) && (i != 38))
         {
-            SubscriptionCount++;
+            HK_Test_SetEntryDataPresent(i);
         }
     }
 
-    UtAssert_INT32_EQ(SubscriptionCount, 0);
+    /* Act */
+    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid, &NumMissing);
+
+    /* Assert */
+    UtAssert_INT32_EQ(ReturnValue, HK_MISSING_DATA_DETECTED);
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(MissingInputMid), 36);
+    UtAssert_UINT16_EQ(NumMissing, 2);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_TearDownOldCopyTable                         */
+/* Test functions for HK_SyncDataPresentFlags                         */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_TearDownCopyTable
+ * Function under test: HK_SyncDataPresentFlags
  *
- * Case: Tests the case where the provided Copy Table Pointer is NULL.
+ * Case: Tests that the run-time table flags follow the bitset.
  */
-void Test_HK_TearDownOldCopyTable_NullCpyTbl(void)
+void Test_HK_SyncDataPresentFlags(void)
 {
     /* Arrange */
-    HK_RuntimeTableEntry_t RtTblPtr;
-    int32                  strCmpResult;
-    CFE_Status_t           ReturnValue;
-
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Null pointer detected in copy tbl tear down: CpyTbl = %%p, RtTbl = %%p");
-
-    /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(NULL, &RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    RtTblPtr[0].DataPresent = HK_DATA_PRESENT;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_TEARCPY_ERR_EID);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    HK_Test_SetEntryDataPresent(1);
+    HK_Test_SetEntryDataPresent(3);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_SyncDataPresentFlags(RtTblPtr);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Assert */
+    UtAssert_INT32_EQ(RtTblPtr[0].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[1].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[2].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[3].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[4].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[5].DataPresent, HK_DATA_NOT_PRESENT);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_BuildOutputIndex                             */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_TearDownCopyTable
+ * Function under test: HK_BuildOutputIndex
  *
- * Case: Tests the case where the provided Runtime Table Pointer is NULL.
+ * Case: Tests that the rows of each output packet are grouped into one
+ *       descriptor, in table order, along with the packet buffer and size.
  */
-void Test_HK_TearDownOldCopyTable_NullRtTbl(void)
+void Test_HK_BuildOutputIndex_Success(void)
 {
     /* Arrange */
-    HK_CopyTableEntry_t CpyTblPtr;
-    int32               strCmpResult;
-    CFE_Status_t        ReturnValue;
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_OutputPktEntry_t *  OutPkt;
+    CFE_SB_Buffer_t        Pkt1Buffer;
+    CFE_SB_Buffer_t        Pkt2Buffer;
+    int32                  i;
 
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Null pointer detected in copy tbl tear down: CpyTbl = %%p, RtTbl = %%p");
+    /* Entries 1 and 3 feed a second packet */
+    CopyTblPtr[1].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[3].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    for (i = 0; i < 5; i++)
+    {
+        if (CFE_SB_MsgIdToValue(CopyTblPtr[i].OutputMid) == HK_COMBINED_PKT2_MID)
+        {
+            RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Pkt2Buffer);
+        }
+        else
+        {
+            RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Pkt1Buffer);
+        }
+    }
 
     /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(&CpyTblPtr, NULL);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_NULL_POINTER_DETECTED);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_NULL_POINTER_TEARCPY_ERR_EID);
+    UtAssert_UINT16_EQ(HK_AppData.NumOutputPkts, 2);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    OutPkt = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID));
+    UtAssert_NOT_NULL(OutPkt);
+    if (OutPkt != NULL)
+    {
+        UtAssert_ADDRESS_EQ(OutPkt->OutBuffer, &Pkt1Buffer);
+        UtAssert_UINT32_EQ(OutPkt->PacketSize, 32);
+        UtAssert_UINT16_EQ(OutPkt->NumEntries, 3);
+        UtAssert_UINT16_EQ(HK_AppData.OutputEntryList[OutPkt->FirstEntry], 0);
+        UtAssert_UINT16_EQ(HK_AppData.OutputEntryList[OutPkt->FirstEntry + 1], 2);
+        UtAssert_UINT16_EQ(HK_AppData.OutputEntryList[OutPkt->FirstEntry + 2], 4);
+    }
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    OutPkt = HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID));
+    UtAssert_NOT_NULL(OutPkt);
+    if (OutPkt != NULL)
+    {
+        UtAssert_ADDRESS_EQ(OutPkt->OutBuffer, &Pkt2Buffer);
+        UtAssert_UINT32_EQ(OutPkt->PacketSize, 28);
+        UtAssert_UINT16_EQ(OutPkt->NumEntries, 2);
+        UtAssert_UINT16_EQ(HK_AppData.OutputEntryList[OutPkt->FirstEntry], 1);
+        UtAssert_UINT16_EQ(HK_AppData.OutputEntryList[OutPkt->FirstEntry + 1], 3);
+    }
 }
 
 /*
- * Function under test: HK_TearDownCopyTable
+ * Function under test: HK_BuildOutputIndex
  *
- * Case: Tests the case where the call to CFE_ES_PutPoolBuf fails.
+ * Case: Tests that an empty run-time table produces no descriptors.
  */
-void Test_HK_TearDownOldCopyTable_PoolFreeFail(void)
+void Test_HK_BuildOutputIndex_EmptyTable(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int          strCmpResult;
-
-    char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "HK TearDown: ES_putPoolBuf Err pkt:0x%%08lX ret 0x%%04X, hdl 0x%%08lx");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PutPoolBuf), (CFE_SUCCESS - 1));
-
     HK_Test_InitGoodCopyTable(CopyTblPtr);
-    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
 
     /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_UINT16_EQ(HK_AppData.NumOutputPkts, 0);
+    UtAssert_NULL(HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID)));
+}
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 5);
+/*
+ * Function under test: HK_BuildOutputIndex
+ *
+ * Case: Tests that the refresh times of a new table start at the current
+ *       MET, so that no data is stale as soon as the table is processed.
+ */
+void Test_HK_BuildOutputIndex_RefreshTime(void)
+{
+    /* Arrange */
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    for (i = 0; i < 5; i++)
-    {
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventID, HK_MEM_POOL_FREE_FAILED_EID);
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[i].EventType, CFE_EVS_EventType_ERROR);
+    UT_MetTime.Seconds = 1000;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_GetMET), UT_CFE_TIME_GetMET_Handler, NULL);
 
-        strCmpResult =
-            strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[i].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-        UtAssert_True(strCmpResult == 0, "Event #%d string matched expected result, '%s'", (int)i,
-                      context_CFE_EVS_SendEvent[i].Spec);
-    }
+    /* Assert */
+#if HK_STALE_DATA_CHECK == 1
+    UtAssert_UINT32_EQ(HK_AppData.RefreshTime[0], 1000);
+    UtAssert_UINT32_EQ(HK_AppData.RefreshTime[4], 1000);
+#else
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 0);
+#endif
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_FindOutputPkt                                */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_TearDownOldCopyTable
+ * Function under test: HK_FindOutputPkt
  *
- * Case: Tests the case where the HK_TearDownOldCopyTable succeeds.
- *       Note that this function has multiple branches that lead to
- *       success. In this case, all of the populated Runtime Table
- *       entries have the same OutputPktAddr.
+ * Case: Tests that a packet that is not in the copy table is not found.
  */
-void Test_HK_TearDownOldCopyTable_Success(void)
+void Test_HK_FindOutputPkt_NotFound(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
+    /* Act */
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_NOT_NULL(HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID)));
+    UtAssert_NULL(HK_FindOutputPkt(CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID)));
+    UtAssert_NULL(HK_FindOutputPkt(HK_UT_MID_100));
+}
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+/****************************************************************************/
 
-    for (i = 0; i < 5; i++)
-    {
-        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr));
-        UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
-    }
-}
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_TransmitOutputPktBuffer                      */
+/*                                                                    */
+/**********************************************************************/
 
 /*
- * Function under test: HK_TearDownOldCopyTable
+ * Function under test: HK_TransmitOutputPktBuffer
  *
- * Case: Tests the case where the provided Copy Table and
- *       Runtime Table have no populated entries.
+ * Case: Tests the case where the packet buffer is handed off to SB and
+ *       the packet moves to a newly allocated buffer.
  */
-void Test_HK_TearDownOldCopyTable_EmptyTable(void)
+void Test_HK_TransmitOutputPktBuffer_Success(void)
 {
     /* Arrange */
-    CFE_Status_t ReturnValue;
-    int32        i;
-    int32        SubscriptionCount = 0;
-
+    uint32                 OldBuffer[8];
+    uint32                 NewBuffer[8];
+    uint16                 i;
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    HK_Test_InitEmptyCopyTable(CopyTblPtr);
-    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
+    memset(OldBuffer, 0xA5, sizeof(OldBuffer));
+    memset(NewBuffer, 0, sizeof(NewBuffer));
 
-    /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    for (i = 0; i < 5; i++)
+    {
+        RtTblPtr[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(OldBuffer);
+    }
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
+
+    UT_AllocatedBuffer = (CFE_SB_Buffer_t *)NewBuffer;
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_CFE_SB_AllocateMessageBuffer_Handler, NULL);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    UtAssert_INT32_EQ(HK_TransmitOutputPktBuffer(&HK_AppData.OutputPkts[0]), CFE_SUCCESS);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].OutBuffer, NewBuffer);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    /* The packet can be sent with missing data, so the data sent carries over */
+    UtAssert_MemCmp((uint8 *)NewBuffer + HK_OUTPUT_HDR_SIZE, (uint8 *)OldBuffer + HK_OUTPUT_HDR_SIZE,
+                    sizeof(NewBuffer) - HK_OUTPUT_HDR_SIZE, "Data sent is kept in the new buffer");
 
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    for (i = 0; i < 5; i++)
     {
-        if (RtTblPtr[i].InputMidSubscribed == HK_INPUTMID_SUBSCRIBED)
-        {
-            SubscriptionCount++;
-        }
+        UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr), NewBuffer);
     }
 
-    UtAssert_INT32_EQ(SubscriptionCount, 0);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].NumOps, HK_AppData.NumCopyOps);
+    for (i = 0; i < HK_AppData.NumCopyOps; i++)
+    {
+        UtAssert_True((HK_AppData.CopyOps[i].DestPtr >= (uint8 *)NewBuffer) &&
+                          (HK_AppData.CopyOps[i].DestPtr < (uint8 *)NewBuffer + sizeof(NewBuffer)),
+                      "Copy operation %u points at the new buffer", (unsigned int)i);
+    }
 }
 
 /*
- * Function under test: HK_TearDownOldCopyTable
+ * Function under test: HK_TransmitOutputPktBuffer
  *
- * Case: Tests the case where the HK_TearDownOldCopyTable succeeds.
- *       Note that this function has multiple branches that lead to
- *       success. In this case, one of the populated Runtime Table
- *       entries has a different OutputPktAddr than the other
- *       populated entries (forcing a different logical path).
+ * Case: Tests the case where no new buffer can be allocated and the
+ *       packet is sent by copy instead.
  */
-void Test_HK_TearDownOldCopyTable_Success2(void)
+void Test_HK_TransmitOutputPktBuffer_AllocFail(void)
 {
     /* Arrange */
-    CFE_Status_t           ReturnValue;
-    int32                  i;
-    CFE_SB_Buffer_t        Buffer;
+    uint32                 OldBuffer[8];
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    RtTblPtr[0].OutputPktAddr = CFE_ES_MEMADDRESS_C(OldBuffer);
 
-    RtTblPtr[4].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* Just needs to not match the
-                                      other filled entries */
-
-    /* Act */
-    ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, CFE_SUCCESS);
+    UT_AllocatedBuffer = NULL;
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_CFE_SB_AllocateMessageBuffer_Handler, NULL);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    /* Act */
+    UtAssert_INT32_EQ(HK_TransmitOutputPktBuffer(&HK_AppData.OutputPkts[0]), CFE_SUCCESS);
 
-    for (i = 0; i < 5; i++)
-    {
-        UtAssert_NULL(CFE_ES_MEMADDRESS_TO_PTR(RtTblPtr[i].OutputPktAddr));
-        UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
-    }
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].OutBuffer, OldBuffer);
 }
 
-/**********************************************************************/
-/*                                                                    */
-/* Test functions for HK_SendCombinedHkPacket                         */
-/*                                                                    */
-/**********************************************************************/
-
 /*
- * Function under test: HK_SendCombinedHkPacket
+ * Function under test: HK_TransmitOutputPktBuffer
  *
- * Case: Tests the case where the HK_SendCombinedHkPacket function
- *       does not see any missing data.
+ * Case: Tests the case where SB does not accept the buffer, so HK keeps
+ *       it and the new one becomes the spare.
  */
-void Test_HK_SendCombinedHkPacket_NoMissingData(void)
+void Test_HK_TransmitOutputPktBuffer_TransmitFail(void)
 {
     /* Arrange */
-    int32          call_count_CFE_SB_TimeStampMsg;
-    int32          call_count_CFE_SB_TransmitMsg;
-    CFE_SB_MsgId_t SendMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
-    int32          i;
-
+    uint32                 OldBuffer[8];
+    uint32                 NewBuffer[8];
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
-
-    for (i = 0; i < 5; i++)
-    {
-        RtTblPtr[i].DataPresent = HK_DATA_PRESENT;
-    }
+    RtTblPtr[0].OutputPktAddr = CFE_ES_MEMADDRESS_C(OldBuffer);
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &SendMid, sizeof(SendMid), false);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-    /* Act */
-    HK_SendCombinedHkPacket(SendMid);
+    UT_AllocatedBuffer = (CFE_SB_Buffer_t *)NewBuffer;
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_CFE_SB_AllocateMessageBuffer_Handler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_TransmitBuffer), CFE_SB_BAD_ARGUMENT);
 
-    call_count_CFE_EVS_SendEvent   = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    call_count_CFE_SB_TimeStampMsg = UT_GetStubCount(UT_KEY(CFE_SB_TimeStampMsg));
-    call_count_CFE_SB_TransmitMsg  = UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg));
+    /* Act */
+    UtAssert_INT32_EQ(HK_TransmitOutputPktBuffer(&HK_AppData.OutputPkts[0]), CFE_SB_BAD_ARGUMENT);
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 0);
-    UtAssert_INT32_EQ(call_count_CFE_SB_TimeStampMsg, 1);
-    UtAssert_INT32_EQ(call_count_CFE_SB_TransmitMsg, 1);
-    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].OutBuffer, OldBuffer);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].SpareBuffer, NewBuffer);
 }
 
 /*
- * Function under test: HK_SendCombinedHkPacket
+ * Function under test: HK_TransmitOutputPktBuffer
  *
- * Case: Tests the case where the HK_SendCombinedHkPacket function
- *       does see missing data.
+ * Case: Tests the case where the packet continues in its spare buffer
+ *       without allocating one.
  */
-void Test_HK_SendCombinedHkPacket_MissingData(void)
+void Test_HK_TransmitOutputPktBuffer_SpareBuffer(void)
 {
     /* Arrange */
-    CFE_SB_MsgId_t SendMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
-
+    uint32                 OldBuffer[8];
+    uint32                 SpareBuffer[8];
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    RtTblPtr[0].OutputPktAddr = CFE_ES_MEMADDRESS_C(OldBuffer);
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &SendMid, sizeof(SendMid), false);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_AppData.OutputPkts[0].SpareBuffer = (CFE_SB_Buffer_t *)SpareBuffer;
 
     /* Act */
-    HK_SendCombinedHkPacket(SendMid);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(HK_TransmitOutputPktBuffer(&HK_AppData.OutputPkts[0]), CFE_SUCCESS);
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 1);
-
-#if HK_DISCARD_INCOMPLETE_COMBO == 0
-    int32 call_count_CFE_SB_TimeStampMsg = UT_GetStubCount(UT_KEY(CFE_SB_TimeStampMsg));
-    int32 call_count_CFE_SB_TransmitMsg  = UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg));
-
-    UtAssert_INT32_EQ(call_count_CFE_SB_TimeStampMsg, 1);
-    UtAssert_INT32_EQ(call_count_CFE_SB_TransmitMsg, 1);
-    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
-#endif
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].OutBuffer, SpareBuffer);
+    UtAssert_NULL(HK_AppData.OutputPkts[0].SpareBuffer);
 }
 
 /*
- * Function under test: HK_SendCombinedHkPacket
+ * Function under test: HK_TransmitOutputPktBuffer
  *
- * Case: Tests the case where the HK_SendCombinedHkPacket function
- *       is called with both the Copy Table and Runtime Table empty.
+ * Case: Tests that a packet that discards incomplete data continues in
+ *       a new buffer without the data sent.
  */
-void Test_HK_SendCombinedHkPacket_EmptyTable(void)
+void Test_HK_TransmitOutputPktBuffer_Discard(void)
 {
     /* Arrange */
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
+    uint32                 OldBuffer[8];
+    uint32                 NewBuffer[8];
+    uint32                 ZeroBuffer[8];
     HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
     HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    HK_Test_InitEmptyCopyTable(CopyTblPtr);
-    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    memset(OldBuffer, 0xA5, sizeof(OldBuffer));
+    memset(NewBuffer, 0, sizeof(NewBuffer));
+    memset(ZeroBuffer, 0, sizeof(ZeroBuffer));
+
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    RtTblPtr[0].OutputPktAddr = CFE_ES_MEMADDRESS_C(OldBuffer);
+
     HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Combined HK Packet 0x%%08lX is not found in current HK Copy Table");
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_AppData.OutputPkts[0].DiscardIncomplete = true;
 
-    /* Act */
-    HK_SendCombinedHkPacket(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
+    UT_AllocatedBuffer = (CFE_SB_Buffer_t *)NewBuffer;
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_CFE_SB_AllocateMessageBuffer_Handler, NULL);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    UtAssert_INT32_EQ(HK_TransmitOutputPktBuffer(&HK_AppData.OutputPkts[0]), CFE_SUCCESS);
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].OutBuffer, NewBuffer);
+    UtAssert_MemCmp(NewBuffer, ZeroBuffer, sizeof(NewBuffer), "New buffer stays zero filled");
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNKNOWN_COMBINED_PACKET_EID);
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_QueueSpareRefill                             */
+/*                                                                    */
+/**********************************************************************/
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+/*
+ * Function under test: HK_QueueSpareRefill
+ *
+ * Case: Tests that a packet is listed once however often it is queued.
+ */
+void Test_HK_QueueSpareRefill(void)
+{
+    /* Arrange */
+    HK_AppData.NumOutputPkts = 3;
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[2]);
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[0]);
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[2]);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.NumSpareRefills, 2);
+    UtAssert_UINT16_EQ(HK_AppData.SpareRefillList[0], 2);
+    UtAssert_UINT16_EQ(HK_AppData.SpareRefillList[1], 0);
+    UtAssert_BOOL_TRUE(HK_AppData.OutputPkts[2].SpareQueued);
+    UtAssert_BOOL_FALSE(HK_AppData.OutputPkts[1].SpareQueued);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_RefillSpareBuffers                           */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_SendCombinedHkPacket
+ * Function under test: HK_RefillSpareBuffers
  *
- * Case: Tests the case where the HK_SendCombinedHkPacket function
- *       is called for a message that is not present in the Copy
- *       Table.
+ * Case: Tests that only the listed packets without a spare buffer get
+ *       one, and that the list is emptied.
  */
-void Test_HK_SendCombinedHkPacket_PacketNotFound(void)
+void Test_HK_RefillSpareBuffers(void)
 {
     /* Arrange */
-    CFE_SB_MsgId_t  forced_MsgID = HK_UT_MID_100; /* does not match provided parameter */
-    int32           strCmpResult;
-    char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    CFE_SB_Buffer_t Buffer;
-
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    HK_Test_InitEmptyCopyTable(CopyTblPtr);
-    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
-
-    /* populate one entry in the RT table */
-    RtTblPtr[1].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* just needs to be non-null */
+    uint32 SpareBuffer[8];
+    uint32 NewBuffer[8];
 
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.NumOutputPkts             = 3;
+    HK_AppData.OutputPkts[0].SpareBuffer = (CFE_SB_Buffer_t *)SpareBuffer;
+    HK_AppData.OutputPkts[1].SpareBuffer = NULL;
+    HK_AppData.OutputPkts[1].PacketSize  = sizeof(NewBuffer);
+    HK_AppData.OutputPkts[2].SpareBuffer = NULL;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Combined HK Packet 0x%%08lX is not found in current HK Copy Table");
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[0]);
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[1]);
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_AllocatedBuffer = (CFE_SB_Buffer_t *)NewBuffer;
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_CFE_SB_AllocateMessageBuffer_Handler, NULL);
 
     /* Act */
-    HK_SendCombinedHkPacket(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_RefillSpareBuffers();
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].SpareBuffer, SpareBuffer);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[1].SpareBuffer, NewBuffer);
+    UtAssert_NULL(HK_AppData.OutputPkts[2].SpareBuffer);
+    UtAssert_UINT16_EQ(HK_AppData.NumSpareRefills, 0);
+    UtAssert_BOOL_FALSE(HK_AppData.OutputPkts[1].SpareQueued);
+
+    /* Allocation failure leaves the packet without a spare */
+    UT_AllocatedBuffer                   = NULL;
+    HK_AppData.OutputPkts[1].SpareBuffer = NULL;
+    HK_QueueSpareRefill(&HK_AppData.OutputPkts[1]);
+
+    HK_RefillSpareBuffers();
+
+    UtAssert_NULL(HK_AppData.OutputPkts[1].SpareBuffer);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+}
+#endif
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNKNOWN_COMBINED_PACKET_EID);
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ReleaseSpareBuffers                          */
+/*                                                                    */
+/**********************************************************************/
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+/*
+ * Function under test: HK_ReleaseSpareBuffers
+ *
+ * Case: Tests that every spare buffer is released once.
+ */
+void Test_HK_ReleaseSpareBuffers(void)
+{
+    /* Arrange */
+    uint32 SpareBuffer[8];
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    HK_AppData.NumOutputPkts             = 2;
+    HK_AppData.OutputPkts[0].SpareBuffer = (CFE_SB_Buffer_t *)SpareBuffer;
+    HK_AppData.OutputPkts[1].SpareBuffer = NULL;
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Act */
+    HK_ReleaseSpareBuffers();
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_NULL(HK_AppData.OutputPkts[0].SpareBuffer);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_CheckStatusOfTables                          */
+/* Test functions for HK_SendScheduledPackets                         */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_CheckStatusOfTables
+ * Function under test: HK_SendScheduledPackets
  *
- * Case: Tests the case where the HK_CheckStatusOfTables function
- *       succeeds.
+ * Case: Tests that only the entries due on the wakeup are sent and
+ *       that unused entries and unknown output MIDs are skipped.
  */
-void Test_HK_CheckStatusOfTables_AllSuccess(void)
+void Test_HK_SendScheduledPackets_Due(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+    HK_RuntimeTableEntry_t   RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t      CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfTables();
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[0].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[0].Period    = 2;
+    SchedTbl[0].Phase     = 1;
+    SchedTbl[1].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[1].Period    = 2;
+    SchedTbl[1].Phase     = 0;
+    SchedTbl[2].OutputMid = HK_UT_MID_100; /* not built by the copy table */
+    SchedTbl[2].Period    = 1;
+    SchedTbl[2].Phase     = 0;
+
+    HK_AppData.SendSchedTablePtr = SchedTbl;
+    HK_AppData.WakeupCounter     = 0;
+
+    /* Act */
+    HK_SendScheduledPackets();
+
+    /* Assert */
+    UtAssert_UINT32_EQ(HK_AppData.WakeupCounter, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 /*
- * Function under test: HK_CheckStatusOfTables
+ * Function under test: HK_SendScheduledPackets
  *
- * Case: Tests the case in which the Copy Table fails its status check.
+ * Case: Tests that the wakeup is counted but nothing is sent when
+ *       there is no send schedule table.
  */
-void Test_HK_CheckStatusOfTables_CpyTblFail(void)
+void Test_HK_SendScheduledPackets_NullTable(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+    HK_AppData.SendSchedTablePtr = NULL;
+    HK_AppData.WakeupCounter     = 5;
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfTables();
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_SendScheduledPackets();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_UINT32_EQ(HK_AppData.WakeupCounter, 6);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ValidateSendSchedTable                       */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_CheckStatusOfTables
+ * Function under test: HK_ValidateSendSchedTable
  *
- * Case: Tests the case in which the Runtime Table fails its status check.
+ * Case: Tests that a table of used and unused entries is accepted.
  */
-void Test_HK_CheckStatusOfTables_RtTblFail(void)
+void Test_HK_ValidateSendSchedTable_Success(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 2, !CFE_SUCCESS); /* copy tbl will pass, rt tbl will fail */
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfTables();
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[0].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[0].Period    = 4;
+    SchedTbl[0].Phase     = 3;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* An entry only sent when complete has no phase to check */
+    SchedTbl[1].OutputMid       = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    SchedTbl[1].Phase           = 7;
+    SchedTbl[1].CompleteTimeout = 5;
+
+    /* Act */
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_SUCCESS);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+/*
+ * Function under test: HK_ValidateSendSchedTable
+ *
+ * Case: Tests that HK_ValidateSendSchedTable returns HK_ERROR
+ */
+void Test_HK_ValidateSendSchedTable_Error(void)
+{
+    /* Arrange */
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
+
+    /* Check output MID missing */
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[1].OutputMid = CFE_SB_INVALID_MSG_ID;
+    SchedTbl[1].Period    = 1;
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_SSTBL_VAL_ERR_EID);
+
+    /* Check phase not less than period */
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[1].OutputMid = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[1].Period    = 2;
+    SchedTbl[1].Phase     = 2;
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_ERROR);
+
+    /* Check output MID missing on an entry only sent when complete */
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[1].OutputMid       = CFE_SB_INVALID_MSG_ID;
+    SchedTbl[1].CompleteTimeout = 5;
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_ERROR);
+
+    /* Check output MID missing on an entry only checked for stale data */
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[1].OutputMid      = CFE_SB_INVALID_MSG_ID;
+    SchedTbl[1].StaleThreshold = 5;
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_ERROR);
+
+    /* Check invalid incomplete packet policy */
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[1].OutputMid        = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[1].IncompletePolicy = HK_INCOMPLETE_POLICY_DISCARD + 1;
+    UtAssert_INT32_EQ(HK_ValidateSendSchedTable(SchedTbl), HK_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 5);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_CheckStatusOfCopyTable                       */
+/* Test functions for HK_CheckStatusOfSendSchedTable                  */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckStatusOfSendSchedTable
  *
- * Case: Tests the case in which the status of the copy table is
- *       CFE_SUCCESS.
+ * Case: Tests the case where the table address is refreshed.
  */
-void Test_HK_CheckStatusOfCopyTable_TblSuccess(void)
+void Test_HK_CheckStatusOfSendSchedTable_Success(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
-
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    HK_AppData.SendSchedTablePtr              = SchedTbl;
+    HK_AppData.NumOutputPkts                  = 1;
+    HK_AppData.OutputPkts[0].WakeupsSinceSend = 3;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+    /* Act */
+    HK_CheckStatusOfSendSchedTable();
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 0);
 }
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckStatusOfSendSchedTable
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus fails.
+ * Case: Tests that nothing is done when no load or dump is pending, so
+ *       the complete timeouts keep running.
  */
-void Test_HK_CheckStatusOfCopyTable_TblStatFail(void)
+void Test_HK_CheckStatusOfSendSchedTable_NoChange(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_GetStatus return (0x%%08X) for Copy Table");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+    HK_AppData.SendSchedTablePtr              = SchedTbl;
+    HK_AppData.NumOutputPkts                  = 1;
+    HK_AppData.OutputPkts[0].WakeupsSinceSend = 3;
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfSendSchedTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_GETSTAT_RET_EID);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_ADDRESS_EQ(HK_AppData.SendSchedTablePtr, SchedTbl);
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+    UtAssert_UINT32_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 3);
 }
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckStatusOfSendSchedTable
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_VALIDATION_PENDING, and the subsequent validation
- *       succeeds.
+ * Case: Tests that a dump that leaves the table unchanged does not
+ *       restart the complete timeouts.
  */
-void Test_HK_CheckStatusOfCopyTable_TblValPendingSuccess(void)
+void Test_HK_CheckStatusOfSendSchedTable_DumpPending(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_VALIDATION_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Validate), CFE_SUCCESS);
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+    HK_AppData.SendSchedTablePtr              = SchedTbl;
+    HK_AppData.NumOutputPkts                  = 1;
+    HK_AppData.OutputPkts[0].WakeupsSinceSend = 3;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    HK_CheckStatusOfSendSchedTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_UINT32_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 3);
 }
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckStatusOfSendSchedTable
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_VALIDATION_PENDING, and the subsequent validation
- *       fails.
+ * Case: Tests the case where the table address cannot be obtained.
  */
-void Test_HK_CheckStatusOfCopyTable_TblValPendingFail(void)
+void Test_HK_CheckStatusOfSendSchedTable_GetAddrFail(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_Validate return (0x%%08X) for Copy Table");
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_VALIDATION_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Validate), !CFE_SUCCESS);
+    HK_AppData.SendSchedTablePtr = SchedTbl;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_ERR_INVALID_HANDLE);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_ERR_INVALID_HANDLE);
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfSendSchedTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_TBLVLD_RET_EID);
-
+    UtAssert_NULL(HK_AppData.SendSchedTablePtr);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_SSTBL_GADR_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckStatusOfSendSchedTable
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
- *       CFE_TBL_ReleaseAddress fails.
+ * Case: Tests that a table address that is still not available is
+ *       not reported again.
  */
-void Test_HK_CheckStatusOfCopyTable_TblInfoUpReleaseFail(void)
+void Test_HK_CheckStatusOfSendSchedTable_GetAddrStillFail(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_ReleaseAddress return (0x%%08X) for Copy Table");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), !CFE_SUCCESS);
+    HK_AppData.SendSchedTablePtr              = NULL;
+    HK_AppData.NumOutputPkts                  = 1;
+    HK_AppData.OutputPkts[0].WakeupsSinceSend = 3;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_ERR_INVALID_HANDLE);
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfSendSchedTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_RELADDR_RET_EID);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    UtAssert_NULL(HK_AppData.SendSchedTablePtr);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 3);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_ApplySendSchedTable                          */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_ApplySendSchedTable
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
- *       CFE_TBL_Update fails.
+ * Case: Tests that the complete timeouts, stale thresholds and incomplete
+ *       packet policies are copied into the output descriptors and reset
+ *       when there is no table.
  */
-void Test_HK_CheckStatusOfCopyTable_TblInfoUpUpdateFail(void)
+void Test_HK_ApplySendSchedTable(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_Update return (0x%%08X) for Copy Table");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), !CFE_SUCCESS);
+    HK_SendSchedTableEntry_t SchedTbl[HK_SEND_SCHED_TABLE_ENTRIES];
+    uint8                    LastSent[32];
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+    memset(SchedTbl, 0, sizeof(SchedTbl));
+    SchedTbl[0].OutputMid       = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    SchedTbl[0].CompleteTimeout = 5;
+    SchedTbl[0].StaleThreshold  = 7;
+    SchedTbl[1].OutputMid       = HK_UT_MID_100; /* not built by the copy table */
+    SchedTbl[1].CompleteTimeout = 6;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    SchedTbl[2].OutputMid        = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    SchedTbl[2].IncompletePolicy = HK_INCOMPLETE_POLICY_DISCARD;
+    SchedTbl[2].Heartbeat        = 4;
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+    HK_AppData.NumOutputPkts                  = 2;
+    HK_AppData.OutputPkts[0].OutputMid        = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+    HK_AppData.OutputPkts[0].CompleteTimeout  = 9;
+    HK_AppData.OutputPkts[0].LastSentData     = LastSent;
+    HK_AppData.OutputPkts[1].OutputMid        = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    HK_AppData.OutputPkts[1].WakeupsSinceSend = 3;
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
+    HK_AppData.SendSchedTablePtr = SchedTbl;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_TBLUPD_RET_EID);
+    /* Act */
+    HK_ApplySendSchedTable();
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].CompleteTimeout, 0);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].CompleteTimeout, 5);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].StaleThreshold, 7);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].WakeupsSinceSend, 0);
+    UtAssert_BOOL_TRUE(HK_AppData.OutputPkts[0].DiscardIncomplete);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].Heartbeat, 4);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].SkippedSends, 4);
+    UtAssert_ADDRESS_EQ(HK_AppData.OutputPkts[0].LastSentData, LastSent);
+    UtAssert_True(HK_AppData.OutputPkts[1].DiscardIncomplete == (HK_DISCARD_INCOMPLETE_COMBO == 1), "Default policy");
+
+    /* No table */
+    HK_AppData.SendSchedTablePtr = NULL;
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_ApplySendSchedTable();
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].CompleteTimeout, 0);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[1].StaleThreshold, 0);
+    UtAssert_True(HK_AppData.OutputPkts[0].DiscardIncomplete == (HK_DISCARD_INCOMPLETE_COMBO == 1), "Default policy");
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].Heartbeat, 0);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_SendCompletedPackets                         */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_SendCompletedPackets
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent call to
- *       CFE_TBL_GetAddress fails.
+ * Case: Tests that only a complete output packet with a complete timeout
+ *       is sent when its input arrives.
  */
-void Test_HK_CheckStatusOfCopyTable_TblInfoUpGetAddrFail(void)
+void Test_HK_SendCompletedPackets(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    const HK_InputIndexEntry_t *IndexEntry;
+    int32                       i;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_GetAddress return (0x%%08X) for Copy Table");
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), !CFE_TBL_INFO_UPDATED);
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+    /* Make the last entry a second combined packet fed by the same input as the first */
+    CopyTblPtr[4].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID);
+    CopyTblPtr[4].OutputOffset = 12;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
+    HK_CompileCopyProgram(CopyTblPtr, RtTblPtr);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 2);
+    HK_AppData.OutputPkts[0].CompleteTimeout  = 3;
+    HK_AppData.OutputPkts[0].WakeupsSinceSend = 2;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HK_UNEXPECTED_GETADDR_RET_EID);
+    for (i = 0; i < 5; i++)
+    {
+        HK_Test_SetEntryDataPresent(i);
+    }
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_CRITICAL);
+    IndexEntry = HK_FindInputIndex(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
+    UtAssert_NOT_NULL(IndexEntry);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[IndexEntry->FirstOp].OutputPkt, 0);
+    UtAssert_UINT16_EQ(HK_AppData.CopyOps[IndexEntry->FirstOp + 1].OutputPkt, 1);
+    UtAssert_BOOL_TRUE(HK_IsOutputPktComplete(&HK_AppData.OutputPkts[0]));
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_SendCompletedPackets(IndexEntry);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.CombinedPacketsSent, 1);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 0);
+    UtAssert_BOOL_FALSE(HK_IsOutputPktComplete(&HK_AppData.OutputPkts[0]));
+
+    /* An incomplete packet is not sent */
+    HK_Test_SetEntryDataPresent(0);
+
+    /* Act */
+    HK_SendCompletedPackets(IndexEntry);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
 }
 
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_CheckCompleteTimeouts                        */
+/*                                                                    */
+/**********************************************************************/
+
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_CheckCompleteTimeouts
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent processing of
- *       the update fails.
+ * Case: Tests that an incomplete output packet is sent once its complete
+ *       timeout expires.
  */
-void Test_HK_CheckStatusOfCopyTable_TblInfoUpProcessFail(void)
+void Test_HK_CheckCompleteTimeouts(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Process New Copy Table Failed, status = 0x%%08X");
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+    HK_BuildOutputIndex(CopyTblPtr, RtTblPtr);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_AppData.OutputPkts[0].CompleteTimeout = 2;
+    HK_Test_SetEntryDataPresent(0);
+
+    /* Act */
+    HK_CheckCompleteTimeouts();
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 3);
+    /* Act */
+    HK_CheckCompleteTimeouts();
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HK_NEWCPYTBL_HK_FAILED_EID);
+    /* Assert */
+    UtAssert_UINT16_EQ(HK_AppData.OutputPkts[0].WakeupsSinceSend, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(HK_AppData.MissingDataCtr, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_CRITICAL);
+#if HK_STALE_DATA_CHECK == 1
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_DropStaleData                                */
+/*                                                                    */
+/**********************************************************************/
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[2].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+/*
+ * Function under test: HK_DropStaleData
+ *
+ * Case: Tests that only the entries older than the stale threshold are
+ *       zero filled and counted.
+ */
+void Test_HK_DropStaleData(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTbl[HK_COPY_TABLE_ENTRIES];
+    HK_OutputPktEntry_t OutPkt;
+    uint8               Buffer[32];
+    CFE_SB_MsgId_t      StaleMid = CFE_SB_INVALID_MSG_ID;
+
+    memset(CopyTbl, 0, sizeof(CopyTbl));
+    CopyTbl[0].InputMid     = HK_UT_MID_100;
+    CopyTbl[0].OutputOffset = 12;
+    CopyTbl[0].NumBytes     = 4;
+    CopyTbl[1].InputMid     = HK_UT_MID_101;
+    CopyTbl[1].OutputOffset = 16;
+    CopyTbl[1].NumBytes     = 4;
+
+    HK_AppData.CopyTablePtr       = CopyTbl;
+    HK_AppData.OutputEntryList[0] = 1;
+    HK_AppData.OutputEntryList[1] = 0;
+    HK_AppData.RefreshTime[0]     = 95;
+    HK_AppData.RefreshTime[1]     = 80;
+
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.OutBuffer      = (CFE_SB_Buffer_t *)Buffer;
+    OutPkt.FirstEntry     = 0;
+    OutPkt.NumEntries     = 2;
+    OutPkt.StaleThreshold = 10;
+
+    memset(Buffer, 0xAA, sizeof(Buffer));
+
+    UT_MetTime.Seconds = 100;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_GetMET), UT_CFE_TIME_GetMET_Handler, NULL);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[2].Spec);
+    /* Act */
+    UtAssert_UINT16_EQ(HK_DropStaleData(&OutPkt, &StaleMid), 1);
+
+    /* Assert */
+    UtAssert_True(CFE_SB_MsgId_Equal(StaleMid, HK_UT_MID_100), "Stale input MID reported");
+    UtAssert_UINT8_EQ(Buffer[12], 0);
+    UtAssert_UINT8_EQ(Buffer[15], 0);
+    UtAssert_UINT8_EQ(Buffer[16], 0xAA);
+    UtAssert_UINT8_EQ(Buffer[11], 0xAA);
 }
 
 /*
- * Function under test: HK_CheckStatusOfCopyTable
+ * Function under test: HK_DropStaleData
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_UPDATE_PENDING, and the subsequent processing of
- *       the update succeeds.
+ * Case: Tests that nothing is dropped from a packet without a stale
+ *       threshold.
  */
-void Test_HK_CheckStatusOfCopyTable_TblInfoUpProcessSuccess(void)
+void Test_HK_DropStaleData_NoThreshold(void)
 {
     /* Arrange */
-    int32                  ReturnValue;
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_OutputPktEntry_t OutPkt;
+    CFE_SB_MsgId_t      StaleMid = CFE_SB_INVALID_MSG_ID;
 
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.NumEntries = 2;
 
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    /* Act */
+    UtAssert_UINT16_EQ(HK_DropStaleData(&OutPkt, &StaleMid), 0);
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Update), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
-    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), UT_CFE_TBL_GetAddress_Handler, NULL);
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 0);
+}
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfCopyTable();
+/*
+ * Function under test: HK_DropStaleData
+ *
+ * Case: Tests that the age of an entry is right when the MET seconds
+ *       wrap between its refresh and the send.
+ */
+void Test_HK_DropStaleData_Wrap(void)
+{
+    /* Arrange */
+    HK_CopyTableEntry_t CopyTbl[HK_COPY_TABLE_ENTRIES];
+    HK_OutputPktEntry_t OutPkt;
+    uint8               Buffer[32];
+    CFE_SB_MsgId_t      StaleMid = CFE_SB_INVALID_MSG_ID;
+
+    memset(CopyTbl, 0, sizeof(CopyTbl));
+    CopyTbl[0].InputMid     = HK_UT_MID_100;
+    CopyTbl[0].OutputOffset = 12;
+    CopyTbl[0].NumBytes     = 4;
+    CopyTbl[1].InputMid     = HK_UT_MID_101;
+    CopyTbl[1].OutputOffset = 16;
+    CopyTbl[1].NumBytes     = 4;
+
+    HK_AppData.CopyTablePtr       = CopyTbl;
+    HK_AppData.OutputEntryList[0] = 0;
+    HK_AppData.OutputEntryList[1] = 1;
+    HK_AppData.RefreshTime[0]     = 0xFFFFFFFE; /* 7 seconds old */
+    HK_AppData.RefreshTime[1]     = 0xFFFFFFF0; /* 21 seconds old */
+
+    memset(&OutPkt, 0, sizeof(OutPkt));
+    OutPkt.OutBuffer      = (CFE_SB_Buffer_t *)Buffer;
+    OutPkt.FirstEntry     = 0;
+    OutPkt.NumEntries     = 2;
+    OutPkt.StaleThreshold = 10;
+
+    memset(Buffer, 0xAA, sizeof(Buffer));
+
+    UT_MetTime.Seconds = 5;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_GetMET), UT_CFE_TIME_GetMET_Handler, NULL);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    UtAssert_UINT16_EQ(HK_DropStaleData(&OutPkt, &StaleMid), 1);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_True(CFE_SB_MsgId_Equal(StaleMid, HK_UT_MID_101), "Stale input MID reported");
+    UtAssert_UINT8_EQ(Buffer[12], 0xAA);
+    UtAssert_UINT8_EQ(Buffer[16], 0);
+    UtAssert_UINT8_EQ(Buffer[19], 0);
 }
+#endif
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_CheckStatusOfDumpTable                       */
+/* Test functions for HK_ResetInputStats                              */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_CheckStatusOfDumpTable
+ * Function under test: HK_ResetInputStats
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_SUCCESS.
+ * Case: Tests that the statistics are cleared and labeled with the
+ *       input MsgIds of the dispatch index.
  */
-void Test_HK_CheckStatusOfDumpTable_TblStatSuccess(void)
+void Test_HK_ResetInputStats(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
+    HK_InputStatsTableEntry_t StatsTbl[HK_COPY_TABLE_ENTRIES];
+    HK_RuntimeTableEntry_t    RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    HK_CopyTableEntry_t       CopyTblPtr[HK_COPY_TABLE_ENTRIES];
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfDumpTable();
+    HK_Test_InitGoodCopyTable(CopyTblPtr);
+    HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_BuildInputIndex(CopyTblPtr, RtTblPtr);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    memset(StatsTbl, 0xFF, sizeof(StatsTbl));
+    HK_AppData.InputStatsTablePtr = StatsTbl;
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
+    /* Act */
+    HK_ResetInputStats();
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    /* Assert */
+    UtAssert_True(CFE_SB_MsgId_Equal(StatsTbl[0].InputMid, HK_AppData.InputIndex[0].InputMid), "First entry labeled");
+    UtAssert_UINT32_EQ(StatsTbl[0].RcvCount, 0);
+    UtAssert_UINT32_EQ(StatsTbl[0].ShortPktCount, 0);
+    UtAssert_True(CFE_SB_MsgId_Equal(StatsTbl[HK_COPY_TABLE_ENTRIES - 1].InputMid, CFE_SB_INVALID_MSG_ID),
+                  "Unused entry invalid");
 }
 
 /*
- * Function under test: HK_CheckStatusOfDumpTable
+ * Function under test: HK_ResetInputStats
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       an error.
+ * Case: Tests the case where there is no input statistics table.
  */
-void Test_HK_CheckStatusOfDumpTable_TblStatFail(void)
+void Test_HK_ResetInputStats_NoTable(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_GetStatus return (0x%%08X) for Runtime Table");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), !CFE_SUCCESS);
+    HK_AppData.InputStatsTablePtr = NULL;
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfDumpTable();
+    UtAssert_VOIDCALL(HK_ResetInputStats());
+}
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+/**********************************************************************/
+/*                                                                    */
+/* Test functions for HK_UpdateInputStats                             */
+/*                                                                    */
+/**********************************************************************/
 
-    /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
+/*
+ * Function under test: HK_UpdateInputStats
+ *
+ * Case: Tests the counts and the min and max intervals over three
+ *       input messages.
+ */
+void Test_HK_UpdateInputStats(void)
+{
+    /* Arrange */
+    HK_InputStatsTableEntry_t StatsTbl[HK_COPY_TABLE_ENTRIES];
 
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    memset(StatsTbl, 0, sizeof(StatsTbl));
+    HK_AppData.InputStatsTablePtr = StatsTbl;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_CFE_TIME_Subtract_Handler, NULL);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_GETSTAT2_RET_EID);
+    /* Act */
+    HK_UpdateInputStats(&HK_AppData.InputIndex[1], false);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+    UT_ElapsedTime.Seconds    = 2;
+    UT_ElapsedTime.Subseconds = 0x80000000;
+    HK_UpdateInputStats(&HK_AppData.InputIndex[1], true);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UT_ElapsedTime.Seconds    = 1;
+    UT_ElapsedTime.Subseconds = 0;
+    HK_UpdateInputStats(&HK_AppData.InputIndex[1], false);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Assert */
+    UtAssert_UINT32_EQ(StatsTbl[1].RcvCount, 3);
+    UtAssert_UINT32_EQ(StatsTbl[1].ShortPktCount, 1);
+    UtAssert_UINT32_EQ(StatsTbl[1].MinInterval, 1000);
+    UtAssert_UINT32_EQ(StatsTbl[1].MaxInterval, 2500);
+    UtAssert_UINT32_EQ(StatsTbl[0].RcvCount, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 3);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 2);
 }
 
 /*
- * Function under test: HK_CheckStatusOfDumpTable
+ * Function under test: HK_UpdateInputStats
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_DUMP_PENDING and the subsequent call to
- *       CFE_TBL_DumpToBuffer succeeds.
+ * Case: Tests that a very long interval saturates.
  */
-void Test_HK_CheckStatusOfDumpTable_TblStatUpDumpSuccess(void)
+void Test_HK_UpdateInputStats_Saturate(void)
 {
     /* Arrange */
-    int32 ReturnValue;
+    HK_InputStatsTableEntry_t StatsTbl[HK_COPY_TABLE_ENTRIES];
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), CFE_SUCCESS);
+    memset(StatsTbl, 0, sizeof(StatsTbl));
+    StatsTbl[0].RcvCount          = 1;
+    HK_AppData.InputStatsTablePtr = StatsTbl;
 
-    /* Act */
-    ReturnValue = HK_CheckStatusOfDumpTable();
+    UT_ElapsedTime.Seconds    = 0xFFFFFFFF;
+    UT_ElapsedTime.Subseconds = 0;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_CFE_TIME_Subtract_Handler, NULL);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Act */
+    HK_UpdateInputStats(&HK_AppData.InputIndex[0], false);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_SUCCESS);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+    UtAssert_UINT32_EQ(StatsTbl[0].MinInterval, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(StatsTbl[0].MaxInterval, 0xFFFFFFFF);
 }
 
 /*
- * Function under test: HK_CheckStatusOfDumpTable
+ * Function under test: HK_UpdateInputStats
  *
- * Case: Tests the case in which the call to CFE_TBL_GetStatus returns
- *       CFE_TBL_INFO_DUMP_PENDING and the subsequent call to
- *       CFE_TBL_DumpToBuffer fails.
+ * Case: Tests that the receive and short packet counts saturate.
  */
-void Test_HK_CheckStatusOfDumpTable_TblStatUpDumpFail(void)
+void Test_HK_UpdateInputStats_SaturateCounts(void)
 {
     /* Arrange */
-    int32 ReturnValue;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HK_InputStatsTableEntry_t StatsTbl[HK_COPY_TABLE_ENTRIES];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Unexpected CFE_TBL_DumpToBuffer return (0x%%08X) for Runtime Table");
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), !CFE_SUCCESS);
+    memset(StatsTbl, 0, sizeof(StatsTbl));
+    StatsTbl[0].RcvCount          = 0xFFFFFFFF;
+    StatsTbl[0].ShortPktCount     = 0xFFFFFFFF;
+    HK_AppData.InputStatsTablePtr = StatsTbl;
 
     /* Act */
-    ReturnValue = HK_CheckStatusOfDumpTable();
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_UpdateInputStats(&HK_AppData.InputIndex[0], true);
 
     /* Assert */
-    UtAssert_INT32_EQ(ReturnValue, HK_ERROR);
-
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_UNEXPECTED_DUMPTOBUFFER_RET_EID);
+    UtAssert_UINT32_EQ(StatsTbl[0].RcvCount, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(StatsTbl[0].ShortPktCount, 0xFFFFFFFF);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+/*
+ * Function under test: HK_UpdateInputStats
+ *
+ * Case: Tests the case where there is no input statistics table.
+ */
+void Test_HK_UpdateInputStats_NoTable(void)
+{
+    /* Arrange */
+    HK_AppData.InputStatsTablePtr = NULL;
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Act */
+    HK_UpdateInputStats(&HK_AppData.InputIndex[0], false);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 0);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_CheckForMissingData                          */
+/* Test functions for HK_CheckStatusOfInputStatsTable                 */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_CheckForMissingData
+ * Function under test: HK_CheckStatusOfInputStatsTable
  *
- * Case: Tests the case in which missing data is detected because
- *       table entries matching the output MID do not have data present.
+ * Case: Tests that a pending dump is performed.
  */
-void Test_HK_CheckForMissingData_MissingData(void)
+void Test_HK_CheckStatusOfInputStatsTable_Dump(void)
 {
     /* Arrange */
-    int32          ReturnValue;
-    CFE_SB_MsgId_t OutPktToCheck   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
-    CFE_SB_MsgId_t MissingInputMid = CFE_SB_INVALID_MSG_ID;
-
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    HK_Test_InitGoodRuntimeTable(RtTblPtr);
-
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), CFE_SUCCESS);
 
     /* Act */
-    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfInputStatsTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(ReturnValue, HK_MISSING_DATA_DETECTED);
-
-    /* Check MissingInputMid is set correctly */
-    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(MissingInputMid), CFE_EVS_HK_TLM_MID);
+    UtAssert_STUB_COUNT(CFE_TBL_DumpToBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 /*
- * Function under test: HK_CheckForMissingData
+ * Function under test: HK_CheckStatusOfInputStatsTable
  *
- * Case: Tests the case in which no missing data is detected because
- *       all entries in the Runtime Table are empty.
+ * Case: Tests the case in which the call to CFE_TBL_DumpToBuffer fails.
  */
-void Test_HK_CheckForMissingData_NoMissingData_AddrNull(void)
+void Test_HK_CheckStatusOfInputStatsTable_DumpFail(void)
 {
     /* Arrange */
-    int32          ReturnValue;
-    CFE_SB_MsgId_t OutPktToCheck   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
-    CFE_SB_MsgId_t MissingInputMid = CFE_SB_INVALID_MSG_ID;
-
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    HK_Test_InitEmptyCopyTable(CopyTblPtr);
-    HK_Test_InitEmptyRuntimeTable(RtTblPtr);
-
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), CFE_TBL_ERR_INVALID_HANDLE);
 
     /* Act */
-    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfInputStatsTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
-
-    /* check that the MissingInputMid did not change */
-    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_ISTBL_DUMP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(HK_AppData.InputStatsTableStatus, CFE_TBL_ERR_INVALID_HANDLE);
 }
 
 /*
- * Function under test: HK_CheckForMissingData
+ * Function under test: HK_CheckStatusOfInputStatsTable
  *
- * Case: Tests the case in which no missing data is detected because
- *       Message ID to check is not present in the table.
+ * Case: Tests that a failure already reported by the previous check is
+ *       not reported again.
  */
-void Test_HK_CheckForMissingData_NoMissingData_OutputMidMismatch(void)
+void Test_HK_CheckStatusOfInputStatsTable_DumpFailRepeated(void)
 {
     /* Arrange */
-    int32          ReturnValue;
-    CFE_SB_MsgId_t OutPktToCheck   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT2_MID); /* MID not in the copy table */
-    CFE_SB_MsgId_t MissingInputMid = CFE_SB_INVALID_MSG_ID;
-
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    HK_Test_InitGoodRuntimeTable(RtTblPtr);
-
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_AppData.InputStatsTableStatus = CFE_TBL_ERR_INVALID_HANDLE;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_DUMP_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_DumpToBuffer), CFE_TBL_ERR_INVALID_HANDLE);
 
     /* Act */
-    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfInputStatsTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
-
-    /* check that the MissingInputMid did not change */
-    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 /*
- * Function under test: HK_CheckForMissingData
+ * Function under test: HK_CheckStatusOfInputStatsTable
  *
- * Case: Tests the case in which no missing data is detected because
- *       table entries matching the Message ID have data present.
+ * Case: Tests the case where no dump is pending.
  */
-void Test_HK_CheckForMissingData_NoMissingData_DataPresent(void)
+void Test_HK_CheckStatusOfInputStatsTable_NoDump(void)
 {
     /* Arrange */
-    int32          ReturnValue;
-    CFE_SB_MsgId_t OutPktToCheck   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID); /* MID in the table */
-    CFE_SB_MsgId_t MissingInputMid = CFE_SB_INVALID_MSG_ID;
-    int32          i;
-
-    HK_RuntimeTableEntry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CopyTblPtr[HK_COPY_TABLE_ENTRIES];
-
-    HK_Test_InitGoodCopyTable(CopyTblPtr);
-    HK_Test_InitGoodRuntimeTable(RtTblPtr);
-
-    for (i = 0; i < 5; i++)
-    {
-        RtTblPtr[i].DataPresent = HK_DATA_PRESENT;
-    }
-
-    HK_AppData.CopyTablePtr    = CopyTblPtr;
-    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_SUCCESS);
 
     /* Act */
-    ReturnValue = HK_CheckForMissingData(OutPktToCheck, &MissingInputMid);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    HK_CheckStatusOfInputStatsTable();
 
     /* Assert */
-    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(ReturnValue, HK_NO_MISSING_DATA);
-
-    /* check that the MissingInputMid did not change */
-    UtAssert_BOOL_FALSE(CFE_SB_IsValidMsgId(MissingInputMid));
+    UtAssert_STUB_COUNT(CFE_TBL_DumpToBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 /**********************************************************************/
 /*                                                                    */
-/* Test functions for HK_SetFlagsToNotPresent                         */
+/* Test functions for HK_GetElapsedSubsecs                            */
 /*                                                                    */
 /**********************************************************************/
 
 /*
- * Function under test: HK_SetFlagsToNotPresent
+ * Function under test: HK_GetElapsedSubsecs
  *
- * Case: Tests the nominal case of the HK_SetFlagsToNotPresent function.
+ * Case: Tests the case where less than a second has elapsed.
  */
-void Test_HK_SetFlagsToNotPresent(void)
+void Test_HK_GetElapsedSubsecs_Nominal(void)
 {
     /* Arrange */
-    int32                  EntriesWithDataPresent = 0;
-    HK_RuntimeTableEntry_t RtTbl[HK_COPY_TABLE_ENTRIES];
-    HK_CopyTableEntry_t    CpyTbl[HK_COPY_TABLE_ENTRIES];
-    CFE_SB_Buffer_t        Buffer;
-    int32                  i;
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
-    {
-        RtTbl[i].OutputPktAddr = CFE_ES_MEMADDRESS_C(&Buffer); /* just needs to be non-null */
-        CpyTbl[i].OutputMid    = CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID);
-        RtTbl[i].DataPresent   = HK_DATA_PRESENT;
-    }
-
-    /* make it so that exactly one entry shouldn't have flags cleared */
-    CpyTbl[0].OutputMid = HK_UT_MID_100;
+    CFE_TIME_SysTime_t StartTime = {0, 0};
 
-    HK_AppData.CopyTablePtr    = CpyTbl;
-    HK_AppData.RuntimeTablePtr = RtTbl;
+    UT_ElapsedTime.Seconds    = 0;
+    UT_ElapsedTime.Subseconds = 1234;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_CFE_TIME_Subtract_Handler, NULL);
 
     /* Act */
-    HK_SetFlagsToNotPresent(CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID));
+    UtAssert_UINT32_EQ(HK_GetElapsedSubsecs(StartTime), 1234);
 
     /* Assert */
-    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
-    {
-        if (RtTbl[i].DataPresent == HK_DATA_PRESENT)
-        {
-            EntriesWithDataPresent++;
-        }
-    }
-
-    UtAssert_INT32_EQ(EntriesWithDataPresent, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 1);
 }
 
-/****************************************************************************/
+/*
+ * Function under test: HK_GetElapsedSubsecs
+ *
+ * Case: Tests the case where a second or more has elapsed and the
+ *       result saturates.
+ */
+void Test_HK_GetElapsedSubsecs_Saturate(void)
+{
+    /* Arrange */
+    CFE_TIME_SysTime_t StartTime = {0, 0};
+
+    UT_ElapsedTime.Seconds    = 1;
+    UT_ElapsedTime.Subseconds = 1234;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_CFE_TIME_Subtract_Handler, NULL);
+
+    /* Act */
+    UtAssert_UINT32_EQ(HK_GetElapsedSubsecs(StartTime), 0xFFFFFFFF);
+}
 
 /*
  * Register the test cases to execute with the unit test tool
@@ -1957,12 +5083,47 @@ void UtTest_Setup(void)
                "Test_HK_ProcessIncomingHkData_LengthOkGreater");
     UtTest_Add(Test_HK_ProcessIncomingHkData_MessageError, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ProcessIncomingHkData_MessageError");
+    UtTest_Add(Test_HK_ProcessIncomingHkData_MultipleEntries, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ProcessIncomingHkData_MultipleEntries");
+    UtTest_Add(Test_HK_ProcessIncomingHkData_MergedShortPacket, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ProcessIncomingHkData_MergedShortPacket");
+
+    /* Test functions for HK_SortEntryList */
+    UtTest_Add(Test_HK_SortEntryList_Stable, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SortEntryList_Stable");
+
+    /* Test functions for HK_LowerBoundEntryList */
+    UtTest_Add(Test_HK_LowerBoundEntryList, HK_Test_Setup, HK_Test_TearDown, "Test_HK_LowerBoundEntryList");
+
+    /* Test functions for HK_BuildInputIndex */
+    UtTest_Add(Test_HK_BuildInputIndex_Success, HK_Test_Setup, HK_Test_TearDown, "Test_HK_BuildInputIndex_Success");
+    UtTest_Add(Test_HK_BuildInputIndex_NoOutputPacket, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_BuildInputIndex_NoOutputPacket");
+    UtTest_Add(Test_HK_BuildInputIndex_EmptyTable, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_BuildInputIndex_EmptyTable");
+
+    /* Test functions for HK_CompileCopyProgram */
+    UtTest_Add(Test_HK_CompileCopyProgram_Merge, HK_Test_Setup, HK_Test_TearDown, "Test_HK_CompileCopyProgram_Merge");
+    UtTest_Add(Test_HK_CompileCopyProgram_PktOps, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CompileCopyProgram_PktOps");
+
+    /* Test functions for HK_FindInputIndex */
+    UtTest_Add(Test_HK_FindInputIndex_Found, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FindInputIndex_Found");
+    UtTest_Add(Test_HK_FindInputIndex_NotFound, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FindInputIndex_NotFound");
 
     /* Test functions for HK_ValidateHkCopyTable */
     UtTest_Add(Test_HK_ValidateHkCopyTable_Success, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ValidateHkCopyTable_Success");
     UtTest_Add(Test_HK_ValidateHkCopyTable_Error, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ValidateHkCopyTable_Error");
 
+    /* Test functions for HK_FindOutputOverlap */
+    UtTest_Add(Test_HK_FindOutputOverlap, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FindOutputOverlap");
+
+    /* Test functions for HK_FindOutputPoolOverflow */
+    UtTest_Add(Test_HK_FindOutputPoolOverflow, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FindOutputPoolOverflow");
+
+    /* Test functions for HK_CountCopyTableRows */
+    UtTest_Add(Test_HK_CountCopyTableRows, HK_Test_Setup, HK_Test_TearDown, "Test_HK_CountCopyTableRows");
+
     /* Test functions for HK_ProcessNewCopyTable */
     UtTest_Add(Test_HK_ProcessNewCopyTable_EmptyTable, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ProcessNewCopyTable_EmptyTable");
@@ -1978,6 +5139,8 @@ void UtTest_Setup(void)
                "Test_HK_ProcessNewCopyTable_Success");
     UtTest_Add(Test_HK_ProcessNewCopyTable_Success2, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ProcessNewCopyTable_Success2");
+    UtTest_Add(Test_HK_ProcessNewCopyTable_ShrinkTable, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ProcessNewCopyTable_ShrinkTable");
     UtTest_Add(Test_HK_ProcessNewCopyTable_PacketSizeZero, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ProcessNewCopyTable_PacketSizeZero");
     UtTest_Add(Test_HK_ProcessNewCopyTable_AllPacketsSizeZero, HK_Test_Setup, HK_Test_TearDown,
@@ -1990,6 +5153,8 @@ void UtTest_Setup(void)
                "Test_HK_TearDownOldCopyTable_NullRtTbl");
     UtTest_Add(Test_HK_TearDownOldCopyTable_PoolFreeFail, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_TearDownOldCopyTable_PoolFreeFail");
+    UtTest_Add(Test_HK_TearDownOldCopyTable_PoolFreeFailContinues, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TearDownOldCopyTable_PoolFreeFailContinues");
     UtTest_Add(Test_HK_TearDownOldCopyTable_Success, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_TearDownOldCopyTable_Success");
     UtTest_Add(Test_HK_TearDownOldCopyTable_EmptyTable, HK_Test_Setup, HK_Test_TearDown,
@@ -1997,6 +5162,51 @@ void UtTest_Setup(void)
     UtTest_Add(Test_HK_TearDownOldCopyTable_Success2, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_TearDownOldCopyTable_Success2");
 
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+    /* Test functions for HK_SavePrevCopyTable */
+    UtTest_Add(Test_HK_SavePrevCopyTable_NullTbl, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SavePrevCopyTable_NullTbl");
+    UtTest_Add(Test_HK_SavePrevCopyTable_Success, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SavePrevCopyTable_Success");
+    UtTest_Add(Test_HK_SavePrevCopyTable_PrevNotProcessed, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SavePrevCopyTable_PrevNotProcessed");
+#endif
+
+    /* Test functions for HK_AllocArenaPkt */
+    UtTest_Add(Test_HK_AllocArenaPkt, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AllocArenaPkt");
+
+    /* Test functions for HK_AllocOutputPkt */
+    UtTest_Add(Test_HK_AllocOutputPkt, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AllocOutputPkt");
+
+#if HK_INCREMENTAL_TABLE_UPDATE == 1
+    /* Test functions for HK_ReusePrevOutputPkt */
+    UtTest_Add(Test_HK_ReusePrevOutputPkt_Unchanged, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ReusePrevOutputPkt_Unchanged");
+    UtTest_Add(Test_HK_ReusePrevOutputPkt_Changed, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ReusePrevOutputPkt_Changed");
+    UtTest_Add(Test_HK_ReusePrevOutputPkt_Freed, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ReusePrevOutputPkt_Freed");
+
+    /* Test functions for HK_FreePrevOutputPkts */
+    UtTest_Add(Test_HK_FreePrevOutputPkts_NotKept, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_FreePrevOutputPkts_NotKept");
+    UtTest_Add(Test_HK_FreePrevOutputPkts_Kept, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FreePrevOutputPkts_Kept");
+
+    /* Test functions for HK_KeepPrevSubscription */
+    UtTest_Add(Test_HK_KeepPrevSubscription, HK_Test_Setup, HK_Test_TearDown, "Test_HK_KeepPrevSubscription");
+
+    /* Test functions for HK_CarryPrevData */
+    UtTest_Add(Test_HK_CarryPrevData_ChangedPkt, HK_Test_Setup, HK_Test_TearDown, "Test_HK_CarryPrevData_ChangedPkt");
+    UtTest_Add(Test_HK_CarryPrevData_KeptPkt, HK_Test_Setup, HK_Test_TearDown, "Test_HK_CarryPrevData_KeptPkt");
+
+    /* Test functions for HK_RestoreCarriedData */
+    UtTest_Add(Test_HK_RestoreCarriedData, HK_Test_Setup, HK_Test_TearDown, "Test_HK_RestoreCarriedData");
+#endif
+
+    /* Test functions for HK_MatchGenCopyTable */
+    UtTest_Add(Test_HK_MatchGenCopyTable_Match, HK_Test_Setup, HK_Test_TearDown, "Test_HK_MatchGenCopyTable_Match");
+    UtTest_Add(Test_HK_MatchGenCopyTable_Differs, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_MatchGenCopyTable_Differs");
+
     /* Test functions for HK_SendCombinedHkPacket */
     UtTest_Add(Test_HK_SendCombinedHkPacket_NoMissingData, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_SendCombinedHkPacket_NoMissingData");
@@ -2007,6 +5217,28 @@ void UtTest_Setup(void)
     UtTest_Add(Test_HK_SendCombinedHkPacket_PacketNotFound, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_SendCombinedHkPacket_PacketNotFound");
 
+    /* Test functions for HK_SendAllCombinedPackets */
+    UtTest_Add(Test_HK_SendAllCombinedPackets, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendAllCombinedPackets");
+
+    /* Test functions for HK_SendOutputPkt */
+    UtTest_Add(Test_HK_SendOutputPkt_IncompletePolicy, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SendOutputPkt_IncompletePolicy");
+    UtTest_Add(Test_HK_SendOutputPkt_Unchanged, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendOutputPkt_Unchanged");
+    UtTest_Add(Test_HK_SendOutputPkt_TransmitFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SendOutputPkt_TransmitFail");
+
+    /* Test functions for HK_SkipUnchangedPkt */
+    UtTest_Add(Test_HK_SkipUnchangedPkt, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SkipUnchangedPkt");
+    UtTest_Add(Test_HK_SkipUnchangedPkt_NoHeartbeat, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SkipUnchangedPkt_NoHeartbeat");
+
+    /* Test functions for HK_AllocLastSentData */
+    UtTest_Add(Test_HK_AllocLastSentData, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AllocLastSentData");
+    UtTest_Add(Test_HK_AllocLastSentData_Fail, HK_Test_Setup, HK_Test_TearDown, "Test_HK_AllocLastSentData_Fail");
+
+    /* Test functions for HK_ReleaseLastSentData */
+    UtTest_Add(Test_HK_ReleaseLastSentData, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ReleaseLastSentData");
+
     /* Test functions for HK_CheckStatusOfTables */
     UtTest_Add(Test_HK_CheckStatusOfTables_AllSuccess, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_CheckStatusOfTables_AllSuccess");
@@ -2048,13 +5280,122 @@ void UtTest_Setup(void)
     /* Test functions for HK_CheckForMissingData */
     UtTest_Add(Test_HK_CheckForMissingData_MissingData, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_CheckForMissingData_MissingData");
-    UtTest_Add(Test_HK_CheckForMissingData_NoMissingData_AddrNull, HK_Test_Setup, HK_Test_TearDown,
-               "Test_HK_CheckForMissingData_NoMissingData_AddrNull");
+    UtTest_Add(Test_HK_CheckForMissingData_NoMissingData_NoEntries, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckForMissingData_NoMissingData_NoEntries");
     UtTest_Add(Test_HK_CheckForMissingData_NoMissingData_OutputMidMismatch, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_CheckForMissingData_NoMissingData_OutputMidMismatch");
     UtTest_Add(Test_HK_CheckForMissingData_NoMissingData_DataPresent, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_CheckForMissingData_NoMissingData_DataPresent");
+    UtTest_Add(Test_HK_CheckForMissingData_SpansWords, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckForMissingData_SpansWords");
 
     /* Test functions for HK_SetFlagsToNotPresent */
     UtTest_Add(Test_HK_SetFlagsToNotPresent, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SetFlagsToNotPresent");
+
+    /* Test functions for HK_GetDataPresentMask */
+    UtTest_Add(Test_HK_GetDataPresentMask, HK_Test_Setup, HK_Test_TearDown, "Test_HK_GetDataPresentMask");
+
+    /* Test functions for HK_SyncDataPresentFlags */
+    UtTest_Add(Test_HK_SyncDataPresentFlags, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SyncDataPresentFlags");
+
+    /* Test functions for HK_BuildOutputIndex */
+    UtTest_Add(Test_HK_BuildOutputIndex_Success, HK_Test_Setup, HK_Test_TearDown, "Test_HK_BuildOutputIndex_Success");
+    UtTest_Add(Test_HK_BuildOutputIndex_EmptyTable, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_BuildOutputIndex_EmptyTable");
+    UtTest_Add(Test_HK_BuildOutputIndex_RefreshTime, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_BuildOutputIndex_RefreshTime");
+
+    /* Test functions for HK_FindOutputPkt */
+    UtTest_Add(Test_HK_FindOutputPkt_NotFound, HK_Test_Setup, HK_Test_TearDown, "Test_HK_FindOutputPkt_NotFound");
+
+    /* Test functions for HK_TransmitOutputPktBuffer */
+    UtTest_Add(Test_HK_TransmitOutputPktBuffer_Success, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TransmitOutputPktBuffer_Success");
+    UtTest_Add(Test_HK_TransmitOutputPktBuffer_AllocFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TransmitOutputPktBuffer_AllocFail");
+    UtTest_Add(Test_HK_TransmitOutputPktBuffer_TransmitFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TransmitOutputPktBuffer_TransmitFail");
+    UtTest_Add(Test_HK_TransmitOutputPktBuffer_SpareBuffer, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TransmitOutputPktBuffer_SpareBuffer");
+    UtTest_Add(Test_HK_TransmitOutputPktBuffer_Discard, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_TransmitOutputPktBuffer_Discard");
+
+#if HK_DOUBLE_BUFFER_OUTPUT == 1
+    /* Test functions for HK_QueueSpareRefill */
+    UtTest_Add(Test_HK_QueueSpareRefill, HK_Test_Setup, HK_Test_TearDown, "Test_HK_QueueSpareRefill");
+
+    /* Test functions for HK_RefillSpareBuffers */
+    UtTest_Add(Test_HK_RefillSpareBuffers, HK_Test_Setup, HK_Test_TearDown, "Test_HK_RefillSpareBuffers");
+#endif
+
+    /* Test functions for HK_ReleaseSpareBuffers */
+    UtTest_Add(Test_HK_ReleaseSpareBuffers, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ReleaseSpareBuffers");
+
+    /* Test functions for HK_SendScheduledPackets */
+    UtTest_Add(Test_HK_SendScheduledPackets_Due, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendScheduledPackets_Due");
+    UtTest_Add(Test_HK_SendScheduledPackets_NullTable, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_SendScheduledPackets_NullTable");
+
+    /* Test functions for HK_ValidateSendSchedTable */
+    UtTest_Add(Test_HK_ValidateSendSchedTable_Success, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ValidateSendSchedTable_Success");
+    UtTest_Add(Test_HK_ValidateSendSchedTable_Error, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ValidateSendSchedTable_Error");
+
+    /* Test functions for HK_CheckStatusOfSendSchedTable */
+    UtTest_Add(Test_HK_CheckStatusOfSendSchedTable_Success, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfSendSchedTable_Success");
+    UtTest_Add(Test_HK_CheckStatusOfSendSchedTable_NoChange, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfSendSchedTable_NoChange");
+    UtTest_Add(Test_HK_CheckStatusOfSendSchedTable_DumpPending, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfSendSchedTable_DumpPending");
+    UtTest_Add(Test_HK_CheckStatusOfSendSchedTable_GetAddrFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfSendSchedTable_GetAddrFail");
+    UtTest_Add(Test_HK_CheckStatusOfSendSchedTable_GetAddrStillFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfSendSchedTable_GetAddrStillFail");
+
+    /* Test functions for HK_ApplySendSchedTable */
+    UtTest_Add(Test_HK_ApplySendSchedTable, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ApplySendSchedTable");
+
+    /* Test functions for HK_SendCompletedPackets */
+    UtTest_Add(Test_HK_SendCompletedPackets, HK_Test_Setup, HK_Test_TearDown, "Test_HK_SendCompletedPackets");
+
+    /* Test functions for HK_CheckCompleteTimeouts */
+    UtTest_Add(Test_HK_CheckCompleteTimeouts, HK_Test_Setup, HK_Test_TearDown, "Test_HK_CheckCompleteTimeouts");
+
+#if HK_STALE_DATA_CHECK == 1
+    /* Test functions for HK_DropStaleData */
+    UtTest_Add(Test_HK_DropStaleData, HK_Test_Setup, HK_Test_TearDown, "Test_HK_DropStaleData");
+    UtTest_Add(Test_HK_DropStaleData_NoThreshold, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_DropStaleData_NoThreshold");
+    UtTest_Add(Test_HK_DropStaleData_Wrap, HK_Test_Setup, HK_Test_TearDown, "Test_HK_DropStaleData_Wrap");
+#endif
+
+    /* Test functions for HK_ResetInputStats */
+    UtTest_Add(Test_HK_ResetInputStats, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ResetInputStats");
+    UtTest_Add(Test_HK_ResetInputStats_NoTable, HK_Test_Setup, HK_Test_TearDown, "Test_HK_ResetInputStats_NoTable");
+
+    /* Test functions for HK_UpdateInputStats */
+    UtTest_Add(Test_HK_UpdateInputStats, HK_Test_Setup, HK_Test_TearDown, "Test_HK_UpdateInputStats");
+    UtTest_Add(Test_HK_UpdateInputStats_Saturate, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_UpdateInputStats_Saturate");
+    UtTest_Add(Test_HK_UpdateInputStats_SaturateCounts, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_UpdateInputStats_SaturateCounts");
+    UtTest_Add(Test_HK_UpdateInputStats_NoTable, HK_Test_Setup, HK_Test_TearDown, "Test_HK_UpdateInputStats_NoTable");
+
+    /* Test functions for HK_CheckStatusOfInputStatsTable */
+    UtTest_Add(Test_HK_CheckStatusOfInputStatsTable_Dump, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfInputStatsTable_Dump");
+    UtTest_Add(Test_HK_CheckStatusOfInputStatsTable_DumpFail, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfInputStatsTable_DumpFail");
+    UtTest_Add(Test_HK_CheckStatusOfInputStatsTable_DumpFailRepeated, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfInputStatsTable_DumpFailRepeated");
+    UtTest_Add(Test_HK_CheckStatusOfInputStatsTable_NoDump, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_CheckStatusOfInputStatsTable_NoDump");
+
+    /* Test functions for HK_GetElapsedSubsecs */
+    UtTest_Add(Test_HK_GetElapsedSubsecs_Nominal, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_GetElapsedSubsecs_Nominal");
+    UtTest_Add(Test_HK_GetElapsedSubsecs_Saturate, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_GetElapsedSubsecs_Saturate");
 }
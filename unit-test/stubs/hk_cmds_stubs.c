@@ -57,6 +57,22 @@ CFE_Status_t HK_ResetCountersCmd(const HK_ResetCountersCmd_t *BufPtr)
     return UT_GenStub_GetReturnValue(HK_ResetCountersCmd, CFE_Status_t);
 }
 
+/*
+ * -------------------------------------------------------
+ * Generated stub function for HK_SendAllCombinedPktsCmd()
+ * -------------------------------------------------------
+ */
+CFE_Status_t HK_SendAllCombinedPktsCmd(const HK_SendAllCombinedPktsCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HK_SendAllCombinedPktsCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HK_SendAllCombinedPktsCmd, const HK_SendAllCombinedPktsCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HK_SendAllCombinedPktsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_SendAllCombinedPktsCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_SendCombinedPktCmd()
@@ -88,3 +104,19 @@ CFE_Status_t HK_SendHkCmd(const HK_SendHkCmd_t *BufPtr)
 
     return UT_GenStub_GetReturnValue(HK_SendHkCmd, CFE_Status_t);
 }
+
+/*
+ * ------------------------------------------
+ * Generated stub function for HK_WakeupCmd()
+ * ------------------------------------------
+ */
+CFE_Status_t HK_WakeupCmd(const HK_WakeupCmd_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HK_WakeupCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(HK_WakeupCmd, const HK_WakeupCmd_t *, BufPtr);
+
+    UT_GenStub_Execute(HK_WakeupCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_WakeupCmd, CFE_Status_t);
+}
@@ -25,17 +25,126 @@
 #include "hk_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_AllocArenaPkt()
+ * ----------------------------------------------
+ */
+CFE_SB_Buffer_t *HK_AllocArenaPkt(size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(HK_AllocArenaPkt, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(HK_AllocArenaPkt, size_t, Size);
+
+    UT_GenStub_Execute(HK_AllocArenaPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_AllocArenaPkt, CFE_SB_Buffer_t *);
+}
+
+/*
+ * --------------------------------------------------
+ * Generated stub function for HK_AllocLastSentData()
+ * --------------------------------------------------
+ */
+bool HK_AllocLastSentData(HK_OutputPktEntry_t *OutPkt)
+{
+    UT_GenStub_SetupReturnBuffer(HK_AllocLastSentData, bool);
+
+    UT_GenStub_AddParam(HK_AllocLastSentData, HK_OutputPktEntry_t *, OutPkt);
+
+    UT_GenStub_Execute(HK_AllocLastSentData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_AllocLastSentData, bool);
+}
+
+/*
+ * -----------------------------------------------
+ * Generated stub function for HK_AllocOutputPkt()
+ * -----------------------------------------------
+ */
+CFE_Status_t HK_AllocOutputPkt(CFE_SB_Buffer_t **BufPtr, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(HK_AllocOutputPkt, CFE_Status_t);
+
+    UT_GenStub_AddParam(HK_AllocOutputPkt, CFE_SB_Buffer_t **, BufPtr);
+    UT_GenStub_AddParam(HK_AllocOutputPkt, size_t, Size);
+
+    UT_GenStub_Execute(HK_AllocOutputPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_AllocOutputPkt, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_ApplySendSchedTable()
+ * ----------------------------------------------------
+ */
+void HK_ApplySendSchedTable(void)
+{
+    UT_GenStub_Execute(HK_ApplySendSchedTable, Basic, NULL);
+}
+
+/*
+ * ------------------------------------------------
+ * Generated stub function for HK_BuildInputIndex()
+ * ------------------------------------------------
+ */
+void HK_BuildInputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_BuildInputIndex, HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_BuildInputIndex, HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_BuildInputIndex, Basic, NULL);
+}
+
+/*
+ * -------------------------------------------------
+ * Generated stub function for HK_BuildOutputIndex()
+ * -------------------------------------------------
+ */
+void HK_BuildOutputIndex(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_BuildOutputIndex, HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_BuildOutputIndex, HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_BuildOutputIndex, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_CarryPrevData()
+ * ----------------------------------------------
+ */
+void HK_CarryPrevData(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_CarryPrevData, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_CarryPrevData, const HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_CarryPrevData, Basic, NULL);
+}
+
+/*
+ * ------------------------------------------------------
+ * Generated stub function for HK_CheckCompleteTimeouts()
+ * ------------------------------------------------------
+ */
+void HK_CheckCompleteTimeouts(void)
+{
+    UT_GenStub_Execute(HK_CheckCompleteTimeouts, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_CheckForMissingData()
  * ----------------------------------------------------
  */
-int32 HK_CheckForMissingData(CFE_SB_MsgId_t OutPktToCheck, CFE_SB_MsgId_t *MissingInputMid)
+int32 HK_CheckForMissingData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *MissingInputMid, uint16 *NumMissing)
 {
     UT_GenStub_SetupReturnBuffer(HK_CheckForMissingData, int32);
 
-    UT_GenStub_AddParam(HK_CheckForMissingData, CFE_SB_MsgId_t, OutPktToCheck);
+    UT_GenStub_AddParam(HK_CheckForMissingData, const HK_OutputPktEntry_t *, OutPkt);
     UT_GenStub_AddParam(HK_CheckForMissingData, CFE_SB_MsgId_t *, MissingInputMid);
+    UT_GenStub_AddParam(HK_CheckForMissingData, uint16 *, NumMissing);
 
     UT_GenStub_Execute(HK_CheckForMissingData, Basic, NULL);
 
@@ -70,6 +179,26 @@ int32 HK_CheckStatusOfDumpTable(void)
     return UT_GenStub_GetReturnValue(HK_CheckStatusOfDumpTable, int32);
 }
 
+/*
+ * -------------------------------------------------------------
+ * Generated stub function for HK_CheckStatusOfInputStatsTable()
+ * -------------------------------------------------------------
+ */
+void HK_CheckStatusOfInputStatsTable(void)
+{
+    UT_GenStub_Execute(HK_CheckStatusOfInputStatsTable, Basic, NULL);
+}
+
+/*
+ * ------------------------------------------------------------
+ * Generated stub function for HK_CheckStatusOfSendSchedTable()
+ * ------------------------------------------------------------
+ */
+void HK_CheckStatusOfSendSchedTable(void)
+{
+    UT_GenStub_Execute(HK_CheckStatusOfSendSchedTable, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_CheckStatusOfTables()
@@ -84,6 +213,295 @@ int32 HK_CheckStatusOfTables(void)
     return UT_GenStub_GetReturnValue(HK_CheckStatusOfTables, int32);
 }
 
+/*
+ * ------------------------------------------------
+ * Generated stub function for HK_CompareInputMid()
+ * ------------------------------------------------
+ */
+int32 HK_CompareInputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
+{
+    UT_GenStub_SetupReturnBuffer(HK_CompareInputMid, int32);
+
+    UT_GenStub_AddParam(HK_CompareInputMid, const HK_CopyTableEntry_t *, Entry1);
+    UT_GenStub_AddParam(HK_CompareInputMid, const HK_CopyTableEntry_t *, Entry2);
+
+    UT_GenStub_Execute(HK_CompareInputMid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_CompareInputMid, int32);
+}
+
+/*
+ * -------------------------------------------------
+ * Generated stub function for HK_CompareOutputMid()
+ * -------------------------------------------------
+ */
+int32 HK_CompareOutputMid(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
+{
+    UT_GenStub_SetupReturnBuffer(HK_CompareOutputMid, int32);
+
+    UT_GenStub_AddParam(HK_CompareOutputMid, const HK_CopyTableEntry_t *, Entry1);
+    UT_GenStub_AddParam(HK_CompareOutputMid, const HK_CopyTableEntry_t *, Entry2);
+
+    UT_GenStub_Execute(HK_CompareOutputMid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_CompareOutputMid, int32);
+}
+
+/*
+ * ------------------------------------------------------
+ * Generated stub function for HK_CompareOutputPosition()
+ * ------------------------------------------------------
+ */
+int32 HK_CompareOutputPosition(const HK_CopyTableEntry_t *Entry1, const HK_CopyTableEntry_t *Entry2)
+{
+    UT_GenStub_SetupReturnBuffer(HK_CompareOutputPosition, int32);
+
+    UT_GenStub_AddParam(HK_CompareOutputPosition, const HK_CopyTableEntry_t *, Entry1);
+    UT_GenStub_AddParam(HK_CompareOutputPosition, const HK_CopyTableEntry_t *, Entry2);
+
+    UT_GenStub_Execute(HK_CompareOutputPosition, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_CompareOutputPosition, int32);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_CompileCopyProgram()
+ * ---------------------------------------------------
+ */
+void HK_CompileCopyProgram(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_CompileCopyProgram, HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_CompileCopyProgram, HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_CompileCopyProgram, Basic, NULL);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_CountCopyTableRows()
+ * ---------------------------------------------------
+ */
+uint16 HK_CountCopyTableRows(const HK_CopyTableEntry_t *CpyTblPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HK_CountCopyTableRows, uint16);
+
+    UT_GenStub_AddParam(HK_CountCopyTableRows, const HK_CopyTableEntry_t *, CpyTblPtr);
+
+    UT_GenStub_Execute(HK_CountCopyTableRows, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_CountCopyTableRows, uint16);
+}
+
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_DropStaleData()
+ * ----------------------------------------------
+ */
+uint16 HK_DropStaleData(const HK_OutputPktEntry_t *OutPkt, CFE_SB_MsgId_t *StaleInputMid)
+{
+    UT_GenStub_SetupReturnBuffer(HK_DropStaleData, uint16);
+
+    UT_GenStub_AddParam(HK_DropStaleData, const HK_OutputPktEntry_t *, OutPkt);
+    UT_GenStub_AddParam(HK_DropStaleData, CFE_SB_MsgId_t *, StaleInputMid);
+
+    UT_GenStub_Execute(HK_DropStaleData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_DropStaleData, uint16);
+}
+
+/*
+ * -----------------------------------------------
+ * Generated stub function for HK_FindInputIndex()
+ * -----------------------------------------------
+ */
+const HK_InputIndexEntry_t *HK_FindInputIndex(CFE_SB_MsgId_t InputMid)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FindInputIndex, const HK_InputIndexEntry_t *);
+
+    UT_GenStub_AddParam(HK_FindInputIndex, CFE_SB_MsgId_t, InputMid);
+
+    UT_GenStub_Execute(HK_FindInputIndex, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FindInputIndex, const HK_InputIndexEntry_t *);
+}
+
+/*
+ * --------------------------------------------------
+ * Generated stub function for HK_FindOutputOverlap()
+ * --------------------------------------------------
+ */
+bool HK_FindOutputOverlap(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx, uint16 *OtherIdx)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FindOutputOverlap, bool);
+
+    UT_GenStub_AddParam(HK_FindOutputOverlap, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_FindOutputOverlap, uint16, NumTblRows);
+    UT_GenStub_AddParam(HK_FindOutputOverlap, uint16 *, EntryIdx);
+    UT_GenStub_AddParam(HK_FindOutputOverlap, uint16 *, OtherIdx);
+
+    UT_GenStub_Execute(HK_FindOutputOverlap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FindOutputOverlap, bool);
+}
+
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_FindOutputPkt()
+ * ----------------------------------------------
+ */
+HK_OutputPktEntry_t *HK_FindOutputPkt(CFE_SB_MsgId_t OutputMid)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FindOutputPkt, HK_OutputPktEntry_t *);
+
+    UT_GenStub_AddParam(HK_FindOutputPkt, CFE_SB_MsgId_t, OutputMid);
+
+    UT_GenStub_Execute(HK_FindOutputPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FindOutputPkt, HK_OutputPktEntry_t *);
+}
+
+/*
+ * -------------------------------------------------------
+ * Generated stub function for HK_FindOutputPoolOverflow()
+ * -------------------------------------------------------
+ */
+bool HK_FindOutputPoolOverflow(const HK_CopyTableEntry_t *CpyTblPtr, uint16 NumTblRows, uint16 *EntryIdx,
+                               uint32 *PoolBytes)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FindOutputPoolOverflow, bool);
+
+    UT_GenStub_AddParam(HK_FindOutputPoolOverflow, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_FindOutputPoolOverflow, uint16, NumTblRows);
+    UT_GenStub_AddParam(HK_FindOutputPoolOverflow, uint16 *, EntryIdx);
+    UT_GenStub_AddParam(HK_FindOutputPoolOverflow, uint32 *, PoolBytes);
+
+    UT_GenStub_Execute(HK_FindOutputPoolOverflow, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FindOutputPoolOverflow, bool);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_FreePrevOutputPkts()
+ * ---------------------------------------------------
+ */
+bool HK_FreePrevOutputPkts(void)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FreePrevOutputPkts, bool);
+
+    UT_GenStub_Execute(HK_FreePrevOutputPkts, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FreePrevOutputPkts, bool);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_GetDataPresentMask()
+ * ---------------------------------------------------
+ */
+uint32 HK_GetDataPresentMask(uint32 WordIdx, uint32 FirstBit, uint32 EndBit)
+{
+    UT_GenStub_SetupReturnBuffer(HK_GetDataPresentMask, uint32);
+
+    UT_GenStub_AddParam(HK_GetDataPresentMask, uint32, WordIdx);
+    UT_GenStub_AddParam(HK_GetDataPresentMask, uint32, FirstBit);
+    UT_GenStub_AddParam(HK_GetDataPresentMask, uint32, EndBit);
+
+    UT_GenStub_Execute(HK_GetDataPresentMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_GetDataPresentMask, uint32);
+}
+
+/*
+ * --------------------------------------------------
+ * Generated stub function for HK_GetElapsedSubsecs()
+ * --------------------------------------------------
+ */
+uint32 HK_GetElapsedSubsecs(CFE_TIME_SysTime_t StartTime)
+{
+    UT_GenStub_SetupReturnBuffer(HK_GetElapsedSubsecs, uint32);
+
+    UT_GenStub_AddParam(HK_GetElapsedSubsecs, CFE_TIME_SysTime_t, StartTime);
+
+    UT_GenStub_Execute(HK_GetElapsedSubsecs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_GetElapsedSubsecs, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_IsOutputPktComplete()
+ * ----------------------------------------------------
+ */
+bool HK_IsOutputPktComplete(const HK_OutputPktEntry_t *OutPkt)
+{
+    UT_GenStub_SetupReturnBuffer(HK_IsOutputPktComplete, bool);
+
+    UT_GenStub_AddParam(HK_IsOutputPktComplete, const HK_OutputPktEntry_t *, OutPkt);
+
+    UT_GenStub_Execute(HK_IsOutputPktComplete, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_IsOutputPktComplete, bool);
+}
+
+/*
+ * -----------------------------------------------------
+ * Generated stub function for HK_KeepPrevSubscription()
+ * -----------------------------------------------------
+ */
+bool HK_KeepPrevSubscription(const HK_CopyTableEntry_t *CpyTblEntry)
+{
+    UT_GenStub_SetupReturnBuffer(HK_KeepPrevSubscription, bool);
+
+    UT_GenStub_AddParam(HK_KeepPrevSubscription, const HK_CopyTableEntry_t *, CpyTblEntry);
+
+    UT_GenStub_Execute(HK_KeepPrevSubscription, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_KeepPrevSubscription, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_LowerBoundEntryList()
+ * ----------------------------------------------------
+ */
+uint16 HK_LowerBoundEntryList(const uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                              const HK_CopyTableEntry_t *Key, HK_CompareFunc_t CompareFunc)
+{
+    UT_GenStub_SetupReturnBuffer(HK_LowerBoundEntryList, uint16);
+
+    UT_GenStub_AddParam(HK_LowerBoundEntryList, const uint16 *, EntryList);
+    UT_GenStub_AddParam(HK_LowerBoundEntryList, uint16, NumEntries);
+    UT_GenStub_AddParam(HK_LowerBoundEntryList, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_LowerBoundEntryList, const HK_CopyTableEntry_t *, Key);
+    UT_GenStub_AddParam(HK_LowerBoundEntryList, HK_CompareFunc_t, CompareFunc);
+
+    UT_GenStub_Execute(HK_LowerBoundEntryList, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_LowerBoundEntryList, uint16);
+}
+
+/*
+ * --------------------------------------------------
+ * Generated stub function for HK_MatchGenCopyTable()
+ * --------------------------------------------------
+ */
+bool HK_MatchGenCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, const HK_RuntimeTableEntry_t *RtTblPtr,
+                          const HK_CopyTableEntry_t *GenTblPtr, uint16 GenNumRows)
+{
+    UT_GenStub_SetupReturnBuffer(HK_MatchGenCopyTable, bool);
+
+    UT_GenStub_AddParam(HK_MatchGenCopyTable, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_MatchGenCopyTable, const HK_RuntimeTableEntry_t *, RtTblPtr);
+    UT_GenStub_AddParam(HK_MatchGenCopyTable, const HK_CopyTableEntry_t *, GenTblPtr);
+    UT_GenStub_AddParam(HK_MatchGenCopyTable, uint16, GenNumRows);
+
+    UT_GenStub_Execute(HK_MatchGenCopyTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_MatchGenCopyTable, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_ProcessIncomingHkData()
@@ -113,6 +531,134 @@ CFE_Status_t HK_ProcessNewCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTa
     return UT_GenStub_GetReturnValue(HK_ProcessNewCopyTable, CFE_Status_t);
 }
 
+/*
+ * -------------------------------------------------
+ * Generated stub function for HK_QueueSpareRefill()
+ * -------------------------------------------------
+ */
+void HK_QueueSpareRefill(HK_OutputPktEntry_t *OutPkt)
+{
+    UT_GenStub_AddParam(HK_QueueSpareRefill, HK_OutputPktEntry_t *, OutPkt);
+
+    UT_GenStub_Execute(HK_QueueSpareRefill, Basic, NULL);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_RefillSpareBuffers()
+ * ---------------------------------------------------
+ */
+void HK_RefillSpareBuffers(void)
+{
+    UT_GenStub_Execute(HK_RefillSpareBuffers, Basic, NULL);
+}
+
+/*
+ * -----------------------------------------------------
+ * Generated stub function for HK_ReleaseCopyTableRows()
+ * -----------------------------------------------------
+ */
+void HK_ReleaseCopyTableRows(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr, uint16 NumTblRows)
+{
+    UT_GenStub_AddParam(HK_ReleaseCopyTableRows, HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_ReleaseCopyTableRows, HK_RuntimeTableEntry_t *, RtTblPtr);
+    UT_GenStub_AddParam(HK_ReleaseCopyTableRows, uint16, NumTblRows);
+
+    UT_GenStub_Execute(HK_ReleaseCopyTableRows, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_ReleaseLastSentData()
+ * ----------------------------------------------------
+ */
+void HK_ReleaseLastSentData(void)
+{
+    UT_GenStub_Execute(HK_ReleaseLastSentData, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_ReleaseSpareBuffers()
+ * ----------------------------------------------------
+ */
+void HK_ReleaseSpareBuffers(void)
+{
+    UT_GenStub_Execute(HK_ReleaseSpareBuffers, Basic, NULL);
+}
+
+/*
+ * ------------------------------------------------
+ * Generated stub function for HK_ResetInputStats()
+ * ------------------------------------------------
+ */
+void HK_ResetInputStats(void)
+{
+    UT_GenStub_Execute(HK_ResetInputStats, Basic, NULL);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_RestoreCarriedData()
+ * ---------------------------------------------------
+ */
+void HK_RestoreCarriedData(void)
+{
+    UT_GenStub_Execute(HK_RestoreCarriedData, Basic, NULL);
+}
+
+/*
+ * ---------------------------------------------------
+ * Generated stub function for HK_ReusePrevOutputPkt()
+ * ---------------------------------------------------
+ */
+CFE_SB_Buffer_t *HK_ReusePrevOutputPkt(const HK_CopyTableEntry_t *CpyTblPtr, const uint16 *EntryList, uint16 NumEntries)
+{
+    UT_GenStub_SetupReturnBuffer(HK_ReusePrevOutputPkt, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(HK_ReusePrevOutputPkt, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_ReusePrevOutputPkt, const uint16 *, EntryList);
+    UT_GenStub_AddParam(HK_ReusePrevOutputPkt, uint16, NumEntries);
+
+    UT_GenStub_Execute(HK_ReusePrevOutputPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_ReusePrevOutputPkt, CFE_SB_Buffer_t *);
+}
+
+/*
+ * --------------------------------------------------
+ * Generated stub function for HK_SavePrevCopyTable()
+ * --------------------------------------------------
+ */
+CFE_Status_t HK_SavePrevCopyTable(const HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HK_SavePrevCopyTable, CFE_Status_t);
+
+    UT_GenStub_AddParam(HK_SavePrevCopyTable, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_SavePrevCopyTable, HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_SavePrevCopyTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_SavePrevCopyTable, CFE_Status_t);
+}
+
+/*
+ * -------------------------------------------------------
+ * Generated stub function for HK_SendAllCombinedPackets()
+ * -------------------------------------------------------
+ */
+uint16 HK_SendAllCombinedPackets(const CFE_SB_MsgId_t *MsgIds, uint16 NumMsgIds)
+{
+    UT_GenStub_SetupReturnBuffer(HK_SendAllCombinedPackets, uint16);
+
+    UT_GenStub_AddParam(HK_SendAllCombinedPackets, const CFE_SB_MsgId_t *, MsgIds);
+    UT_GenStub_AddParam(HK_SendAllCombinedPackets, uint16, NumMsgIds);
+
+    UT_GenStub_Execute(HK_SendAllCombinedPackets, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_SendAllCombinedPackets, uint16);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_SendCombinedHkPacket()
@@ -125,18 +671,101 @@ void HK_SendCombinedHkPacket(CFE_SB_MsgId_t WhichMidToSend)
     UT_GenStub_Execute(HK_SendCombinedHkPacket, Basic, NULL);
 }
 
+/*
+ * -----------------------------------------------------
+ * Generated stub function for HK_SendCompletedPackets()
+ * -----------------------------------------------------
+ */
+void HK_SendCompletedPackets(const HK_InputIndexEntry_t *IndexEntry)
+{
+    UT_GenStub_AddParam(HK_SendCompletedPackets, const HK_InputIndexEntry_t *, IndexEntry);
+
+    UT_GenStub_Execute(HK_SendCompletedPackets, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_SendOutputPkt()
+ * ----------------------------------------------
+ */
+bool HK_SendOutputPkt(HK_OutputPktEntry_t *OutPkt, bool SendIncomplete)
+{
+    UT_GenStub_SetupReturnBuffer(HK_SendOutputPkt, bool);
+
+    UT_GenStub_AddParam(HK_SendOutputPkt, HK_OutputPktEntry_t *, OutPkt);
+    UT_GenStub_AddParam(HK_SendOutputPkt, bool, SendIncomplete);
+
+    UT_GenStub_Execute(HK_SendOutputPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_SendOutputPkt, bool);
+}
+
+/*
+ * -----------------------------------------------------
+ * Generated stub function for HK_SendScheduledPackets()
+ * -----------------------------------------------------
+ */
+void HK_SendScheduledPackets(void)
+{
+    UT_GenStub_Execute(HK_SendScheduledPackets, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_SetFlagsToNotPresent()
  * ----------------------------------------------------
  */
-void HK_SetFlagsToNotPresent(CFE_SB_MsgId_t OutPkt)
+void HK_SetFlagsToNotPresent(const HK_OutputPktEntry_t *OutPkt)
 {
-    UT_GenStub_AddParam(HK_SetFlagsToNotPresent, CFE_SB_MsgId_t, OutPkt);
+    UT_GenStub_AddParam(HK_SetFlagsToNotPresent, const HK_OutputPktEntry_t *, OutPkt);
 
     UT_GenStub_Execute(HK_SetFlagsToNotPresent, Basic, NULL);
 }
 
+/*
+ * -------------------------------------------------
+ * Generated stub function for HK_SkipUnchangedPkt()
+ * -------------------------------------------------
+ */
+bool HK_SkipUnchangedPkt(HK_OutputPktEntry_t *OutPkt)
+{
+    UT_GenStub_SetupReturnBuffer(HK_SkipUnchangedPkt, bool);
+
+    UT_GenStub_AddParam(HK_SkipUnchangedPkt, HK_OutputPktEntry_t *, OutPkt);
+
+    UT_GenStub_Execute(HK_SkipUnchangedPkt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_SkipUnchangedPkt, bool);
+}
+
+/*
+ * ----------------------------------------------
+ * Generated stub function for HK_SortEntryList()
+ * ----------------------------------------------
+ */
+void HK_SortEntryList(uint16 *EntryList, uint16 NumEntries, const HK_CopyTableEntry_t *CpyTblPtr,
+                      HK_CompareFunc_t CompareFunc)
+{
+    UT_GenStub_AddParam(HK_SortEntryList, uint16 *, EntryList);
+    UT_GenStub_AddParam(HK_SortEntryList, uint16, NumEntries);
+    UT_GenStub_AddParam(HK_SortEntryList, const HK_CopyTableEntry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_SortEntryList, HK_CompareFunc_t, CompareFunc);
+
+    UT_GenStub_Execute(HK_SortEntryList, Basic, NULL);
+}
+
+/*
+ * -----------------------------------------------------
+ * Generated stub function for HK_SyncDataPresentFlags()
+ * -----------------------------------------------------
+ */
+void HK_SyncDataPresentFlags(HK_RuntimeTableEntry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_SyncDataPresentFlags, HK_RuntimeTableEntry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_SyncDataPresentFlags, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_TearDownOldCopyTable()
@@ -154,6 +783,35 @@ CFE_Status_t HK_TearDownOldCopyTable(HK_CopyTableEntry_t *CpyTblPtr, HK_RuntimeT
     return UT_GenStub_GetReturnValue(HK_TearDownOldCopyTable, CFE_Status_t);
 }
 
+/*
+ * --------------------------------------------------------
+ * Generated stub function for HK_TransmitOutputPktBuffer()
+ * --------------------------------------------------------
+ */
+CFE_Status_t HK_TransmitOutputPktBuffer(HK_OutputPktEntry_t *OutPkt)
+{
+    UT_GenStub_SetupReturnBuffer(HK_TransmitOutputPktBuffer, CFE_Status_t);
+
+    UT_GenStub_AddParam(HK_TransmitOutputPktBuffer, HK_OutputPktEntry_t *, OutPkt);
+
+    UT_GenStub_Execute(HK_TransmitOutputPktBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_TransmitOutputPktBuffer, CFE_Status_t);
+}
+
+/*
+ * -------------------------------------------------
+ * Generated stub function for HK_UpdateInputStats()
+ * -------------------------------------------------
+ */
+void HK_UpdateInputStats(const HK_InputIndexEntry_t *IndexEntry, bool ShortPkt)
+{
+    UT_GenStub_AddParam(HK_UpdateInputStats, const HK_InputIndexEntry_t *, IndexEntry);
+    UT_GenStub_AddParam(HK_UpdateInputStats, bool, ShortPkt);
+
+    UT_GenStub_Execute(HK_UpdateInputStats, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_ValidateHkCopyTable()
@@ -169,3 +827,19 @@ int32 HK_ValidateHkCopyTable(void *TblPtr)
 
     return UT_GenStub_GetReturnValue(HK_ValidateHkCopyTable, int32);
 }
+
+/*
+ * -------------------------------------------------------
+ * Generated stub function for HK_ValidateSendSchedTable()
+ * -------------------------------------------------------
+ */
+int32 HK_ValidateSendSchedTable(void *TblPtr)
+{
+    UT_GenStub_SetupReturnBuffer(HK_ValidateSendSchedTable, int32);
+
+    UT_GenStub_AddParam(HK_ValidateSendSchedTable, void *, TblPtr);
+
+    UT_GenStub_Execute(HK_ValidateSendSchedTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_ValidateSendSchedTable, int32);
+}
@@ -131,6 +131,26 @@ void HK_Test_InitEmptyCopyTable(HK_CopyTableEntry_t *CpyTbl)
     }
 }
 
+uint16 HK_Test_InitPoolOverflowCopyTable(HK_CopyTableEntry_t *CpyTbl)
+{
+    uint16 i       = 0;
+    uint16 NumPkts = (sizeof(HK_AppData.MemPoolBuffer.Data) / HK_OUTPUT_BLOCK_SIZE(HK_MAX_COMBINED_PACKET_SIZE)) + 1;
+
+    HK_Test_InitEmptyCopyTable(CpyTbl);
+
+    /* One packet of the largest size more than the memory pool holds */
+    for (i = 0; i < NumPkts; i++)
+    {
+        CpyTbl[i].InputMid     = CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID);
+        CpyTbl[i].InputOffset  = 12;
+        CpyTbl[i].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID + i);
+        CpyTbl[i].OutputOffset = HK_MAX_COMBINED_PACKET_SIZE - 4;
+        CpyTbl[i].NumBytes     = 4;
+    }
+
+    return NumPkts;
+}
+
 void HK_Test_InitGoodRuntimeTable(HK_RuntimeTableEntry_t *RtTbl)
 {
     int32                   i = 0;
@@ -174,12 +194,20 @@ void HK_Test_InitEmptyRuntimeTable(HK_RuntimeTableEntry_t *RtTbl)
     }
 }
 
+void HK_Test_SetEntryDataPresent(uint16 EntryIdx)
+{
+    uint16 BitPos = HK_AppData.OutputBitPos[EntryIdx];
+
+    HK_AppData.DataPresentBits[BitPos / HK_DATA_PRESENT_WORD_BITS] |= (uint32)1 << (BitPos % HK_DATA_PRESENT_WORD_BITS);
+}
+
 void HK_Test_Setup(void)
 {
     /* initialize test environment to default state for every test */
     UT_ResetState(0);
 
     memset(&HK_AppData, 0, sizeof(HK_AppData));
+    HK_AppData.NumCopyTableRows = HK_COPY_TABLE_ENTRIES;
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
     memset(&context_CFE_ES_WriteToSysLog, 0, sizeof(context_CFE_ES_WriteToSysLog));
 
@@ -52,16 +52,25 @@ extern CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
 
 /* Unit test ids */
 #define HK_UT_MID_100   CFE_SB_ValueToMsgId(100)
+#define HK_UT_MID_101   CFE_SB_ValueToMsgId(101)
 #define HK_UT_MEMPOOL_1 CFE_ES_MEMHANDLE_C(CFE_RESOURCEID_WRAP(1))
 
 void HK_Test_InitGoodCopyTable(HK_CopyTableEntry_t *CpyTbl);
 
 void HK_Test_InitEmptyCopyTable(HK_CopyTableEntry_t *CpyTbl);
 
+uint16 HK_Test_InitPoolOverflowCopyTable(HK_CopyTableEntry_t *CpyTbl);
+
 void HK_Test_InitGoodRuntimeTable(HK_RuntimeTableEntry_t *RtTbl);
 
 void HK_Test_InitEmptyRuntimeTable(HK_RuntimeTableEntry_t *RtTbl);
 
+/*
+ * Marks the data of a copy table entry as present in the data present bitset,
+ * requires HK_BuildOutputIndex to have been called
+ */
+void HK_Test_SetEntryDataPresent(uint16 EntryIdx);
+
 /*
  * Setup function prior to every test
  */